@@ -17,17 +17,32 @@
 
      (*) CONNECTION FUNCTIONS
          rociConInit     - CONnection INITialize handle
+         rociConPool     - CONnection taken from a session POOL
          rociConError    - CONnection get and reset last ERRor
          rociConInfo     - CONnection get INFO
          rociConTerm     - CONnection TERMinate handle
          rociConCommit   - CONnection transaction COMMIT
          rociConRollback - CONnection transaction ROLLBACK
+         rociConDirPath  - CONnection DIRect PATH load of a table
+         rociConWritePar - CONnection WRITE in PARallel sessions
+         rociConQueries  - CONnections run QUERIES at the same time
          rodbiAssertCon  - CONnection validation
 
+     (*) POOL FUNCTIONS
+         rociPoolInit    - session POOL INITialize handle
+         rociPoolInfo    - session POOL get INFO
+         rociPoolTerm    - session POOL TERMinate handle
+
      (*) RESULT FUNCTIONS
          rociResInit     - RESult INITialize handle and execute statement
          rociResExec     - RESult re-EXECute
          rociResFetch    - RESult FETCH data
+         rociResFactors  - RESult set FACTOR columns
+         rociResPipeline - RESult fetch in a background PIPELINE
+         rociResAsync    - RESult executed ASYNChronously
+         rociResReady    - Is asynchronous RESult READY?
+         rociResAwait    - RESult AWAIT asynchronous execute
+         rociResCancel   - RESult CANCEL asynchronous execute
          rociResInfo     - RESult get INFO
          rociEOFRes      - Is end of result set?
          rociResTerm     - RESult TERMinate handle
@@ -44,26 +59,68 @@
 
      (*) CONNECTION FUNCTIONS
          rodbiGetCon
+         rodbiConWait
          rodbiConInfoResults
+         rodbiConLoadFail
+         rodbiConParPlain
+         rodbiConParWait
+         rodbiConParFail
+         rodbiConParFree
+         rodbiQrysStart
+         rodbiQrysWork
+         rodbiQrysFetch
+         rodbiQrysRun
+         rodbiQrysOutput
+         rodbiQrysFree
+
+     (*) POOL FUNCTIONS
+         rodbiGetPool
+         rodbiPoolTerm
 
      (*) RESULT FUNCTIONS
          rodbiGetRes
          rodbiResExecStmt
          rodbiResExecQuery
          rodbiResExecBind
+         rodbiResExecPipe
+         rodbiResExecFail
          rodbiResBind
          rodbiPlsqlResBind
          rodbiResBindCopy
+         rodbiBindDirect
+         rodbiResBindDirect
+         rodbiResBindPack
+         rodbiResBindAt
+         rodbiResBindPipe
+         rodbiResBindPlain
+         rodbiResBindDate
+         rodbiResBindGrow
          rodbiResAlloc
          rodbiResExpand
          rodbiResSplit
+         rodbiResKernel
+         rodbiResKernelSel
+         rodbiResDirect
+         rodbiSCacheReset
+         rodbiSCacheMkChar
+         rodbiStrHash
+         rodbiDictCode
+         rodbiDictLevels
+         rodbiDictFree
          rodbiResAccum
+         rodbiResAccumKernel
          rodbiResAccumInCache
+         rodbiResAccumInCacheKernel
+         rodbiNextNull
          rodbiResTrim
          rodbiResDataFrame
          rodbiResStateNext
          rodbiResInfoStmt
          rodbiResInfoFields
+         rodbiResInfoBatch
+         rodbiResAsyncWork
+         rodbiResAsyncDone
+         rodbiResAsyncWait
 
      (*) ERROR CHECK FUNCTIONS
          rodbiCheck
@@ -71,6 +128,40 @@
    NOTES
 
    MODIFIED   (MM/DD/YY)
+   rpingte     10/18/26 - pipeline bind copy only in a threaded environment
+   rpingte     10/18/26 - pipeline fetch only in a threaded environment
+   rpingte     10/18/26 - check parallel write binds before the sessions log
+                          on and warn when it runs in a single session
+   rpingte     10/18/26 - grow dictionary levels with ROOCI_MEM_REALLOC
+   rpingte     10/18/26 - own error handle of an asynchronous statement, wait
+                          for it before other calls on its connection
+   rpingte     10/18/26 - add keep_credentials to rociConInit
+   rpingte     10/18/26 - write a range of rows per parallel session, report
+                          the rows committed when a commit fails
+   rpingte     10/18/26 - execute a statement asynchronously in a worker thread
+   rpingte     10/18/26 - run queries on several connections in worker threads
+   rpingte     10/18/26 - add threaded driver mode
+   rpingte     10/18/26 - add DRCP connection class, purity and drop_session
+   rpingte     10/18/26 - add session pool and connections taken from it
+   rpingte     10/18/26 - grow bind buffers of execute only when needed
+   rpingte     10/18/26 - bind LOBs of INSERT and UPDATE as data
+   rpingte     10/18/26 - bind POSIXct as DATE or TIMESTAMP written in C
+   rpingte     10/18/26 - write rows in parallel sessions
+   rpingte     10/18/26 - report rows in error of array DML
+   rpingte     10/18/26 - add direct path load for dbWriteTable
+   rpingte     10/18/26 - copy bind chunk while the previous one executes
+   rpingte     10/18/26 - size string binds for each chunk of rows
+   rpingte     10/17/26 - bind numeric and integer vectors without a copy
+   rpingte     10/17/26 - take LOB data from the batched LOB read
+   rpingte     10/17/26 - size bulk_read auto from a byte budget
+   rpingte     10/17/26 - overlap fetch of next batch with conversion
+   rpingte     10/17/26 - decode DATE and TIMESTAMP(0) columns in batches
+   rpingte     10/17/26 - fetch character columns as factors
+   rpingte     10/17/26 - add per column CHARSXP cache
+   rpingte     10/17/26 - replace page cache with columnar chunk arena
+   rpingte     10/17/26 - copy runs of non-NULL fixed width data in bulk
+   rpingte     10/17/26 - fetch fixed width columns directly into R vectors
+   rpingte     10/17/26 - select per column accumulation kernels after define
    rpingte     10/17/25 - change __FUNCTION__ to __func__
    rpingte     05/10/25 - add sparse vector support
    rpingte     04/25/25 - Bug 37777349: support data > 32767 in bind to CLOB
@@ -200,14 +291,41 @@
 #include "rooci.h"
 #include "rodbi.h"
 
+/*
+** SSE2 and AVX2 scans of the NULL indicators, AVX2 is used only when the
+** CPU supports it at run time
+*/
+#if defined(__GNUC__) && defined(__x86_64__) && \
+    (defined(__clang__) || (__GNUC__ > 4) ||   \
+     ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9)))
+#define RODBI_SIMD_X86
+#include <immintrin.h>
+#endif
+
 #define RODBI_ERR_INVALID_DRV      _("invalid driver")
 #define RODBI_ERR_INVALID_CON      _("invalid connection")
 #define RODBI_ERR_INVALID_RES      _("invalid result set")
+#define RODBI_ERR_INVALID_POOL     _("invalid session pool")
 #define RODBI_ERR_UNKNOWN_VFMT     _("ROracle internal error [unexpected vector format %d, expected *Iflex), float16, float32, float64, int8 or binary]")
 #define RODBI_ERR_MEMORY_ALC       _("memory could not be allocated")
 #define RODBI_ERR_MANY_ROWS        _("bind data has too many rows")
 #define RODBI_ERR_BIND_MISMATCH    _("bind data does not match bind specification")
 #define RODBI_ERR_BIND_EMPTY       _("bind data is empty")
+#define RODBI_ERR_BIND_ROWS        _("\nwhile writing rows %d to %d, failed at row %d")
+#define RODBI_ERR_LOAD_ROWS        _("\nwhile loading rows %d to %d")
+#define RODBI_ERR_PAR_ROWS         _("\nwhile writing rows %d to %d in session %d of %d")
+#define RODBI_ERR_PAR_COMMIT       _("\nwhile committing session %d of %d, rows 1 to %d of the sessions before it are committed")
+#define RODBI_WAR_PAR_CREDENTIALS  _("argument 'parallel' ignored, the connection was not made with keep_credentials = TRUE")
+#define RODBI_WAR_PAR_EXTPROC      _("argument 'parallel' ignored, sessions cannot be opened in an external procedure")
+#define RODBI_WAR_PAR_ONE_CHUNK    _("argument 'parallel' ignored, the rows fit in a single batch of bulk_write rows")
+#define RODBI_WAR_PAR_BIND         _("argument 'parallel' ignored, a column needs calls to the Oracle client to bind")
+#define RODBI_ERR_PAR_NO_COMMIT    _("\nwhile committing session 1 of %d, no rows are committed")
+#define RODBI_ERR_QRYS_THREADED    _("driver must be created with threaded = TRUE to run queries at the same time")
+#define RODBI_ERR_QRYS_SAME_CON    _("a connection can be given only once")
+#define RODBI_ERR_QRYS_NOT_QUERY   _("statement %d is not a query")
+#define RODBI_ERR_QRYS_STMT        _("\nwhile running statement %d")
+#define RODBI_ERR_ASYNC_BINDS      _("asynchronous statement cannot have binds")
+#define RODBI_ERR_ASYNC_CANCEL     _("asynchronous statement was cancelled")
 #define RODBI_ERR_UNSUPP_BIND_TYPE _("unsupported bind type")
 #define RODBI_ERR_UNSUPP_COL_TYPE  _("unsupported column type")
 #define RODBI_ERR_INTERNAL         _("ROracle internal error [%s, %d, %d]")
@@ -243,7 +361,9 @@
 
 #define RODBI_DRV_ERR_CHECKWD     -1                      /* Invalid object */
 #define RODBI_BULK_READ         1000               /* rodbi BULK READ count */ 
+#define RODBI_BULK_READ_AUTO       0     /* BULK READ sized from byte budget */
 #define RODBI_BULK_WRITE        1000              /* rodbi BULK WRITE count */
+#define RODBI_CSID_AL32UTF8      873                /* AL32UTF8 charset id */
 
 
 /* RODBI FATAL error */
@@ -297,6 +417,12 @@ do                                                      \
 }                                                       \
 while (0)
 
+/* DRCP session purity of the code passed from R */
+#define RODBI_PURITY(purity_)                                         \
+  ((INTEGER(purity_)[0] == 1) ? OCI_ATTR_PURITY_NEW  :                \
+   (INTEGER(purity_)[0] == 2) ? OCI_ATTR_PURITY_SELF :                \
+                                OCI_ATTR_PURITY_DEFAULT)
+
 #define RODBI_CHECK_VERSION(_pctx)                      \
   (((_pctx)->compiled_maj_roociCtx >= 23) &&             \
    ((_pctx)->ver_roociCtx.maj_roociloadVersion < 23))
@@ -405,7 +531,7 @@ do                                                                          \
 /* forward declarations */
 struct rodbiCon;
 struct rodbiRes;
-typedef struct rodbichdl rodbichdl;
+typedef struct rodbiArena rodbiArena;
 
 /* parameter modes for PL/SQL */
 enum mode
@@ -428,6 +554,62 @@ enum rodbiState
 };
 typedef enum rodbiState rodbiState;
 
+/* RODBI accumulation KERNel of a column, selected once after define */
+enum rodbiKern
+{
+  GEN_rodbiKern,           /* GENeric per cell conversion (LOB, UDT, etc.) */
+  INT_rodbiKern,                        /* SQLT_INT into an INTEGER vector */
+  FLT_rodbiKern,           /* SQLT_FLT or SQLT_BDOUBLE into a NUMERIC vector */
+  STR_rodbiKern,         /* SQLT_STR in native or UTF-8 into CHARACTER vector */
+  UCS_rodbiKern,      /* SQLT_STR in UCS2 converted to UTF-8 (TimesTen NCHAR) */
+  BIN_rodbiKern,                               /* SQLT_BIN into a RAW list */
+  DAT_rodbiKern,                  /* SQLT_TIMESTAMP_LTZ into POSIXct vector */
+  DIF_rodbiKern,                  /* SQLT_INTERVAL_DS into a difftime vector */
+  FAC_rodbiKern,           /* SQLT_STR in native or UTF-8 into factor codes */
+  FUC_rodbiKern,          /* SQLT_STR in UCS2 converted to UTF-8 into factor */
+  DTN_rodbiKern                  /* SQLT_DAT decoded in C into POSIXct vector */
+};
+
+/* number of dates decoded at a time before adding to an arena */
+#define RODBI_DATE_BATCH    256
+typedef enum rodbiKern rodbiKern;
+
+/* number of CHARSXPs cached for each column, must be a power of 2 */
+#define RODBI_SCACHE_SIZE     256
+
+/* number of lookups after which the hit rate of a cache is checked */
+#define RODBI_SCACHE_PROBE    1024
+
+/* minimum hit rate in percent for a cache to stay enabled */
+#define RODBI_SCACHE_MIN_HIT  50
+
+/* RODBI String CACHE of a column, reuses CHARSXPs of repeated values */
+struct rodbiSCache
+{
+  boolean  off_rodbiSCache;          /* cache turned OFF due to low hit rate */
+  int      wlkp_rodbiSCache;              /* LooKuPs in current check Window */
+  int      whit_rodbiSCache;                 /* HITs in current check Window */
+  double   lkp_rodbiSCache;                       /* total number of LooKuPs */
+  double   hit_rodbiSCache;                          /* total number of HITs */
+  SEXP     chr_rodbiSCache[RODBI_SCACHE_SIZE];            /* cached CHARSXPs */
+};
+typedef struct rodbiSCache rodbiSCache;
+
+/* initial number of hash table slots of a factor dictionary */
+#define RODBI_DICT_SIZE       64
+
+/* RODBI DICTionary of the distinct values of a factor column */
+struct rodbiDict
+{
+  int      nlev_rodbiDict;                               /* Number of LEVels */
+  int      tabsz_rodbiDict;                /* hash TABle SiZe, a power of 2 */
+  int     *tab_rodbiDict;             /* hash TABle of level numbers, 0 empty */
+  ub4     *hash_rodbiDict;                              /* HASH of each level */
+  int     *len_rodbiDict;                             /* LENgth of each level */
+  char   **dat_rodbiDict;                               /* DATa of each level */
+};
+typedef struct rodbiDict rodbiDict;
+
 /* RODBI DRiVer */
 struct rodbiDrv
 {
@@ -451,9 +633,33 @@ struct rodbiCon
   int        nrows_rodbiCon;      /* No. of rows to allocate in prefetch or */
                                                    /* array fetch operation */
   int        nrows_write_rodbiCon;  /* Number of elements to bind at a time */
+  struct rodbiPar *par_rodbiCon;      /* PARallel write in progress or NULL */
 };
 typedef struct rodbiCon rodbiCon;
 
+/* RODBI session POOL */
+struct rodbiPool
+{
+  ub4        magicWord_rodbiPool;    /* Magic word to check struct validity */
+  rodbiDrv  *drv_rodbiPool;                                 /* rodbi DRiVer */
+  roociPool  pool_rodbiPool;                            /* OCI session pool */
+};
+typedef struct rodbiPool rodbiPool;
+
+/* RODBI ASYNChronous execute of a result by dbSendQueryAsync */
+struct rodbiAsync
+{
+  OCIThreadMutex   *mtx_rodbiAsync;           /* MuTeX of done flag or NULL */
+  OCIThreadId      *tid_rodbiAsync;                     /* worker Thread ID */
+  OCIThreadHandle  *thd_rodbiAsync;                 /* worker THread hanDle */
+  sword             rc_rodbiAsync;             /* Return Code of the worker */
+  boolean           done_rodbiAsync;        /* worker DONE, under the mutex */
+  text              msg_rodbiAsync[ROOCI_ERR_LEN];         /* error MeSsaGe */
+  OCIError         *err_rodbiAsync;            /* worker's own ERRor handle */
+  roociCon          con_rodbiAsync;     /* CONnection as seen by the worker */
+};
+typedef struct rodbiAsync rodbiAsync;
+
 /* RODBI RESult */
 struct rodbiRes
 {
@@ -462,6 +668,7 @@ struct rodbiRes
   roociRes   res_rodbiRes;                                /* OCI Result set */
   ub2        styp_rodbiRes;                               /* Statement TYPe */
   boolean    cnvtxt_rodbiRes;    /* sql text utf-8 needs conversion to env? */
+  rodbiAsync *async_rodbiRes;               /* ASYNChronous execute or NULL */
   /* ------------------------------- FETCH -------------------------------- */
   boolean    ociprefetch_rodbiRes;             /* use OCI's prefetch buffer */
   int        nrows_rodbiRes;      /* No. of rows to allocate in prefetch or */
@@ -475,7 +682,7 @@ struct rodbiRes
   boolean    done_rodbiRes;                                /* DONE fetching */
   boolean    expand_rodbiRes;                /* adaptively EXPAND data list */
   int        affrows_rodbiRes;           /* No of rows affected; [13843811] */
-  rodbichdl *pghdl_rodbiRes;    /* PaGe data HaNDles for accessing col data */
+  rodbiArena *arena_rodbiRes;           /* column ARENAs caching result set */
   SEXP       name_rodbiRes;                          /* column NAMEs vector */
   SEXP       list_rodbiRes;                                    /* data LIST */
   rodbiState state_rodbiRes;                      /* query processing STATE */
@@ -484,9 +691,63 @@ struct rodbiRes
   SEXP       list;                                    /* OUT bind data list */
   SEXP       name;                                 /* OUT bind NAMEs vector */
   mode      *mode_rodbiRes;               /* paramater mode for PL/SQL bind */
+  ub1       *kern_rodbiRes;          /* accumulation KERNel for each column */
+  boolean    direct_rodbiRes;   /* fixed width data fetched DIRECTly into R */
+  rodbiSCache *scache_rodbiRes;              /* String CACHE for each column */
+  rodbiDict *dict_rodbiRes;           /* factor DICTionary for each column */
+  /* ------------------------------- WRITE -------------------------------- */
+  boolean    pipe_rodbiRes;      /* copy binds while previous chunk executes */
 };
 typedef struct rodbiRes rodbiRes;
 
+/* RODBI PARallel write over worker sessions */
+struct rodbiPar
+{
+  roociCtx      ctx_rodbiPar;        /* threaded OCI context of the workers */
+  int           cnt_rodbiPar;                   /* CouNT of worker sessions */
+  ub2           styp_rodbiPar;                            /* Statement TYPe */
+  rodbiCon     *con_rodbiPar;                         /* worker CONnections */
+  rodbiRes     *res_rodbiPar;                /* worker statements and binds */
+  roociThrCtx  *thr_rodbiPar;                     /* worker execute THReads */
+  ub4          *rows_rodbiPar;              /* ROWS affected by each worker */
+  int          *beg_rodbiPar;           /* first row of each worker's chunk */
+  int          *end_rodbiPar;     /* END of the rows of each worker's range */
+  int           cmt_rodbiPar;      /* sessions CoMmiTted, -1 before commits */
+};
+typedef struct rodbiPar rodbiPar;
+
+/* RODBI QueRY of dbGetQueries running on one connection */
+struct rodbiQry
+{
+  struct rodbiQrys *all_rodbiQry;                /* ALL queries of the call */
+  rodbiCon         *con_rodbiQry;                       /* rodbi CONnection */
+  rodbiRes         *res_rodbiQry;         /* RESult running, NULL when idle */
+  int               qid_rodbiQry;       /* Query ID, index of the statement */
+  OCIThreadId      *tid_rodbiQry;                       /* worker Thread ID */
+  OCIThreadHandle  *thd_rodbiQry;                   /* worker THread hanDle */
+  sword             rc_rodbiQry;               /* Return Code of the worker */
+  boolean           arena_rodbiQry;          /* rows fetched into the ARENA */
+  boolean           done_rodbiQry;          /* worker DONE, under the mutex */
+};
+typedef struct rodbiQry rodbiQry;
+
+/* RODBI QueRieS of dbGetQueries run at the same time */
+struct rodbiQrys
+{
+  rodbiDrv         *drv_rodbiQrys;                          /* rodbi DRiVer */
+  OCIThreadMutex   *mtx_rodbiQrys;               /* MuTeX of the done flags */
+  int               cnt_rodbiQrys;                  /* CouNT of connections */
+  rodbiQry         *qry_rodbiQrys;            /* a QueRY of each connection */
+  SEXP              stmt_rodbiQrys;                    /* STateMenTs to run */
+  SEXP              out_rodbiQrys;            /* OUTput list of data frames */
+  int               next_rodbiQrys;              /* NEXT statement to start */
+  int               left_rodbiQrys;            /* statements LEFT to output */
+  boolean           pref_rodbiQrys;            /* use OCI's PREFetch buffer */
+  int               nrows_rodbiQrys;              /* No. of ROWS of a fetch */
+  double            nbytes_rodbiQrys;          /* BYTES of a fetch for auto */
+};
+typedef struct rodbiQrys rodbiQrys;
+
 
 /* rodbi Internal TYPe TABle */
 const rodbiITyp rodbiITypTab[] =
@@ -529,51 +790,56 @@ const rodbiITyp rodbiITypTab[] =
 #endif
 };
 
-/* default maximum size of a page is 65536 for fixed data types */
-#define RODBI_MAX_FIXED_PAGE_SIZE (int)0x10000
+/* initial size of a chunk in a column arena */
+#define RODBI_MIN_CHUNK_SIZE (size_t)0x10000
 
-/* default maximum size of a page is 65536*2 for variable data types */
-#define RODBI_MAX_VAR_PAGE_SIZE (int)0x20000
+/* chunks double in size up to 8MB to keep allocations few */
+#define RODBI_MAX_CHUNK_SIZE (size_t)0x800000
 
+/* length of a NULL variable length item */
 #define RODBI_VCOL_NULL     (int)-1
-#define RODBI_VCOL_NO_REF   (int)-2
 
-/* Each page representation */
-struct rodbiPg
+/* Each chunk of contiguous column data */
+struct rodbiChunk
+{
+  struct rodbiChunk *next_rodbiChunk;                          /* next chunk */
+  size_t             size_rodbiChunk;        /* SIZE of data buffer in bytes */
+  size_t             used_rodbiChunk;      /* bytes USED in the data buffer */
+  union
+  {
+    double           algn_rodbiChunk;     /* ALiGNs data for doubles & ints */
+    ub1              dat_rodbiChunk[1];                      /* chunk data */
+  } buf_rodbiChunk;
+};
+typedef struct rodbiChunk rodbiChunk;
+
+/* Chain of chunks holding one stream of column data */
+struct rodbiStrm
 {
-  struct rodbiPg *next_rodbiPg;
-  ub1             buf_rodbiPg[1];
+  rodbiChunk *beg_rodbiStrm;                                   /* head chunk */
+  rodbiChunk *cur_rodbiStrm;          /* chunk being appended to or read from */
+  size_t      off_rodbiStrm;             /* read OFFset in the current chunk */
+  boolean     nomem_rodbiStrm;      /* NO MEMory for a chunk, items dropped */
 };
-typedef struct rodbiPg rodbiPg;
+typedef struct rodbiStrm rodbiStrm;
 
 /*
-** variable length column data type: char, raw, blob, clob, etc.
+** Column arena caching a result set. Fixed width values, or the lengths of
+** variable width values (RODBI_VCOL_NULL when NULL), are kept contiguous in
+** the fixed stream. Bytes of variable width values are kept in the variable
+** stream, an item never spans two chunks.
 */
-struct rodbivcol
-{
-  ub1        flag_rodbivcol;                         /* flag for column data */
-#define RODBI_VCOL_FLG_NOTNULL         0x00      /* column value is not NULL */
-#define RODBI_VCOL_FLG_NULL            0x01          /* column value is NULL */
-#define RODBI_VCOL_FLG_ELEM_IN_NEXT_PG 0x02         /* value is in next page */
-#define RODBI_VCOL_FLG_ELEM_REF_ACCESS 0x04     /* access by ref is possible */
-  ub4        len_rodbivcol;                        /* length of column value */
-  ub1        dat_rodbivcol[1];                                /* column data */
-};
-typedef struct rodbivcol rodbivcol;
-
-/* Handle to traverse the pages to access data */
-struct rodbichdl
-{
-  int      pgsize_rodbichdl;                        /* max size of each page */
-  int      totpgs_rodbichdl;                             /* total pages used */
-  int      extpgs_rodbichdl;  /* number of pages in extent that are not used */
-  int      actual_maxlen_rodbichdl; /* actual maximum length of var in cache */
-  rodbiPg *begpg_rodbichdl;                                     /* head page */
-  rodbiPg *currpg_rodbichdl;          /* current page that is being accessed */
-  rodbiPg *lastpg_rodbichdl;              /* last page page in column handle */
-  int      offset_rodbichdl;       /* item offset in page accessed currently */
+struct rodbiArena
+{
+  rodbiStrm  fix_rodbiArena;                 /* FIXed width values or lengths */
+  rodbiStrm  var_rodbiArena;                   /* VARiable width value bytes */
 };
 
+/* a stream of the column arena ran out of memory */
+#define RODBI_ARENA_NOMEM(arena)                                          \
+  ((arena)->fix_rodbiArena.nomem_rodbiStrm ||                             \
+   (arena)->var_rodbiArena.nomem_rodbiStrm)
+
 /* RODBI CHECK error using DRiVer handle */
 #define RODBI_CHECK_DRV(drv, fun, pos, free_drv, function_to_invoke)   \
 do                                                                     \
@@ -762,301 +1028,86 @@ struct rodbild                                            /* RODBI Large Data */
 };
 typedef struct rodbild rodbild;
     
-/*
-** Name:      RODBI_CREATE_COL_HDL - ROracle DBI CREATE COLumn HanDLe
-**
-** Function:  This function initializes the column handle to write data into
-**            paged memory.
-**
-** Input:     hdl(IN)     - address of rodbichdl
-**            pgsize(IN)  - max size of each page
-**            blob(IN)    - TRUE if it a BLOB, CLOB or BFILE
-**
-** Exception: Fatal error when memory cannot be allocated.
-**
-** Returns:   Initialized collection handle on success.
-**
-*/
-#define RODBI_CREATE_COL_HDL(hdl, pgsize)                                     \
-do                                                                            \
-{                                                                             \
-  ROOCI_MEM_ALLOC((hdl)->begpg_rodbichdl,                                     \
-                  ((pgsize) + sizeof(rodbiPg *)), sizeof(ub1));               \
-  if (!(hdl)->begpg_rodbichdl)                                                \
-    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);                                        \
-  (hdl)->pgsize_rodbichdl = (pgsize);                                         \
-  (hdl)->lastpg_rodbichdl = (hdl)->begpg_rodbichdl;                           \
-  RODBI_EXTEND_PAGES((hdl), (hdl)->begpg_rodbichdl, 1);                       \
-  (hdl)->currpg_rodbichdl = (hdl)->begpg_rodbichdl;                           \
-  (hdl)->totpgs_rodbichdl = 0;                                                \
-  (hdl)->extpgs_rodbichdl = 1;                                                \
-  (hdl)->actual_maxlen_rodbichdl = 0;                                         \
-  (hdl)->offset_rodbichdl = 0;                                                \
-}                                                                             \
-while (0)
-
-
-/*
-** Name:      RODBI_REPOSITION_COL_HDL - ROracle DBI RE-POSITION COLumn HanDLe
-**
-** Function:  This function repositions the column handle to the beginning of
-**            paged memory to be used to read the data.
-**
-** Input:     hdl(IN)     - address of rodbichdl
-**
-** Exception: None
-**
-** Returns:   Initialized collection handle.
-**
-*/
-#define RODBI_REPOSITION_COL_HDL(hdl)               \
-do                                                  \
-{                                                   \
-  (hdl)->currpg_rodbichdl = (hdl)->begpg_rodbichdl; \
-  (hdl)->offset_rodbichdl = 0;                      \
-} while (0)
-
-
-/*
-** Name:      RODBI_DESTROY_COL_HDL - ROracle DBI DESTROY COLumn HanDLe
-**
-** Function:  This function closes the column handle after freeing all pages
-**            allocated.
-**
-** Input:     hdl(IN)     - address of rodbichdl
-**
-** Exception: None
-**
-** Returns:   None.
-**
-*/
-#define RODBI_DESTROY_COL_HDL(hdl)             \
-do                                             \
-{                                              \
-  rodbiPg *tmppg;                              \
-  if (hdl)                                     \
-  {                                            \
-    tmppg = (hdl)->begpg_rodbichdl;            \
-    if ((hdl)->begpg_rodbichdl)                \
-    {                                          \
-      while (tmppg)                            \
-      {                                        \
-        rodbiPg *tmppg2 = tmppg->next_rodbiPg; \
-        ROOCI_MEM_FREE(tmppg);                 \
-        tmppg = tmppg2;                        \
-      }                                        \
-    }                                          \
-                                               \
-    (hdl)->begpg_rodbichdl = NULL;             \
-  }                                            \
-} while(0)
-
-
-/*
-** Name:      RODBI_EXTEND_PAGES - ROracle DBI EXTEND PAGE table
-**
-** Function:  This function allocates number of pages at the end of the list
-**            navigating from current page.
-**
-** Input:     hdl(IN)     - address of rodbichdl
-**            curr_page(IN) - current page that hdl is operating with
-**            npages(IN) - number of pages to extend bye
-**
-** Exception: Fatal error when memory cannot be allocated.
-**
-** Returns:   None.
-**
-*/
-#define RODBI_EXTEND_PAGES(hdl, curr_page, npages)                         \
-do                                                                         \
-{                                                                          \
-  rodbiPg *tmppg = (curr_page);                                            \
-  int      npg = (npages);                                                 \
-                                                                           \
-  tmppg = (hdl)->lastpg_rodbichdl;                                         \
-                                                                           \
-  while(npg--)                                                             \
-  {                                                                        \
-    ROOCI_MEM_MALLOC(tmppg->next_rodbiPg,                                  \
-                     ((hdl)->pgsize_rodbichdl + sizeof(rodbiPg *)),        \
-                     sizeof(ub1));                                         \
-    if (!tmppg->next_rodbiPg)                                              \
-      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);                                   \
-    else                                                                   \
-      tmppg = tmppg->next_rodbiPg;                                         \
-    ((hdl)->extpgs_rodbichdl++);                                           \
-  }                                                                        \
-  (hdl)->lastpg_rodbichdl = tmppg;                                         \
-  tmppg->next_rodbiPg = (rodbiPg *)0;                                      \
-} while (0)
-
-
-
 /*
 ** Name:      RODBI_ADD_FIXED_DATA_ITEM - ROracle DBI ADD a FIXED len DATA ITEM
-**                                        to page table
+**                                        to column arena
 **
-** Function:  This function adds an integer or double data item to paged memory
-**            at the current offset and incrementing it to add next item.
-**            Before adding an item it expands the page table when the item
-**            does not fit in the page adjusting the current offset.
+** Function:  This function appends an integer or double data item to the
+**            fixed stream of the column arena. A new chunk is added only when
+**            the item does not fit in the current chunk.
 **
-** Input:     hdl(IN)     - address of rodbichdl
+** Input:     arena(IN)   - address of rodbiArena
 **            T(IN)       - type of data
-**            data(IN)    - integer value to be copied into the page
+**            data(IN)    - value to be copied into the arena
 **
-** Exception: Fatal error when memory cannot be allocated.
+** Exception: Sets nomem_rodbiStrm when memory cannot be allocated.
 **
 ** Returns:   None.
 **
 */
-#define RODBI_ADD_FIXED_DATA_ITEM(hdl, T, data)                               \
+#define RODBI_ADD_FIXED_DATA_ITEM(arena, T, data)                             \
 do                                                                            \
 {                                                                             \
-  T *pdata;                                                                   \
-  if ((hdl)->offset_rodbichdl + (int)sizeof(T) > (hdl)->pgsize_rodbichdl)     \
+  rodbiChunk *chk_  = (arena)->fix_rodbiArena.cur_rodbiStrm;                  \
+  T           item_ = (data);                                                 \
+  if (chk_ &&                                                                 \
+      ((chk_->used_rodbiChunk + sizeof(T)) <= chk_->size_rodbiChunk))         \
   {                                                                           \
-    if ((hdl)->currpg_rodbichdl->next_rodbiPg)                                \
-      (hdl)->currpg_rodbichdl = (hdl)->currpg_rodbichdl->next_rodbiPg;        \
-    else                                                                      \
-    {                                                                         \
-      RODBI_EXTEND_PAGES((hdl), (hdl)->currpg_rodbichdl, 1);                  \
-      (hdl)->currpg_rodbichdl = (hdl)->currpg_rodbichdl->next_rodbiPg;        \
-    }                                                                         \
-    (hdl)->totpgs_rodbichdl++;                                                \
-    (hdl)->extpgs_rodbichdl--;                                                \
-    (hdl)->offset_rodbichdl = 0;                                              \
+    memcpy(&chk_->buf_rodbiChunk.dat_rodbiChunk[chk_->used_rodbiChunk],       \
+           &item_, sizeof(T));                                                \
+    chk_->used_rodbiChunk += sizeof(T);                                       \
   }                                                                           \
-  pdata = (T *)(&(hdl)->currpg_rodbichdl->buf_rodbiPg[(hdl)->offset_rodbichdl]);\
-  *pdata = (data);                                                           \
-  (hdl)->offset_rodbichdl += sizeof(T);                                       \
+  else                                                                        \
+    rodbiArenaAdd(&(arena)->fix_rodbiArena, &item_, sizeof(T), 1);            \
 } while (0)
 
 
-
-/*
-** Name:     RODBI_GET_FIXED_DATA_ITEM - ROracle DBI GET an FIXED len DATA ITEM
-**                                       from page table at current offset
-**
-** Function:  This function copies an integer data from paged memory at the
-**            current offset into address pointed by data. Current offset is
-**            incremented to get the next item.
-**
-** Input:     hdl(IN)   - address of rodbichdl
-**            T(IN)     - type of data item
-**            data(IN)  - pointer to integer where data will be copied to
-**            res(IN)   - result set
-**
-** Exception: Fatal error when accessing beyond page limit.
-**
-** Returns:   None.
-**
-*/
-#define RODBI_GET_FIXED_DATA_ITEM(hdl, T, data, res)                          \
-do                                                                            \
-{                                                                             \
-  T *pdata;                                                                   \
-  if ((hdl)->offset_rodbichdl + (int)sizeof(T) > (hdl)->pgsize_rodbichdl)     \
-  {                                                                           \
-    if ((hdl)->currpg_rodbichdl->next_rodbiPg)                                \
-      (hdl)->currpg_rodbichdl = (hdl)->currpg_rodbichdl->next_rodbiPg;        \
-    else                                                                      \
-      RODBI_FATAL(__func__, 1, (res)->state_rodbiRes);                    \
-    (hdl)->offset_rodbichdl = 0;                                              \
-  }                                                                           \
-  pdata = (T *)&((hdl)->currpg_rodbichdl->buf_rodbiPg[(hdl)->offset_rodbichdl]); \
-  *((T *)data) = *pdata;                                                      \
-  (hdl)->offset_rodbichdl += sizeof(T);                                       \
-} while(0)
-
-
 /*
-** Name:     RODBI_GET_MAX_VAR_ITEM_LEN - ROracle DBI GET MAXimum VARiable data
-**                                        ITEM LENgth that is store in paged
-**                                        table
+** Name:      RODBI_ADD_FIXED_DATA_ITEMS - ROracle DBI ADD FIXED len DATA ITEMS
+**                                         to column arena
 **
-** Function:  This function returns the maximum length of an item that is
-**            currently stored in the entire paged table.
+** Function:  This function appends an array of integer or double data items
+**            to the fixed stream of the column arena with one copy per chunk.
 **
-** Input:     hdl(IN)     - address of rodbichdl
-**            maxlen(IN)  - maximum length of an element stored currently
+** Input:     arena(IN)   - address of rodbiArena
+**            T(IN)       - type of data
+**            data(IN)    - address of the first item to be copied
+**            cnt(IN)     - number of items to be copied
 **
-** Exception: None.
+** Exception: Sets nomem_rodbiStrm when memory cannot be allocated.
 **
 ** Returns:   None.
 **
 */
-#define RODBI_GET_MAX_VAR_ITEM_LEN(hdl, maxlen) \
-  (*maxlen) = (hdl)->actual_maxlen_rodbichdl
-
+#define RODBI_ADD_FIXED_DATA_ITEMS(arena, T, data, cnt)                       \
+  rodbiArenaAdd(&(arena)->fix_rodbiArena, (data), sizeof(T), (cnt))
 
 
 /*
-** Name:      RODBI_GET_VAR_DATA_ITEM_BY_REF - ROracle DBI GET a VARiable DATA
-**                                             ITEM from page table BY REFrence
+** Name:      RODBI_ADD_VAR_DATA_ITEM - ROracle DBI ADD a VARiable length DATA
+**                                      ITEM to column arena
 **
-** Function:  This function returns the pointer to data item from paged memory
-**            at the current offset. Current offset incremented to get the next
-**            item. This access applies to VARCHAR, RAW and CHAR data only used
-**            avoid an extra memcpy.
-**            For LOB's use RODBI_GET_VAR_DATA_ITEM_BY.
+** Function:  This function appends the length of a variable length data item
+**            to the fixed stream and its bytes to the variable stream of the
+**            column arena.
 **
-** Input:     hdl(IN)      - address of rodbichdl
-**            data(IN)     - pointer to buffer where data will be copied to
-**            len(IN)      - length of data in paged memory
-**                           -1 - indicates NULL
-**            res(IN)      - result set
+** Input:     arena(IN)   - address of rodbiArena
+**            data(IN)    - pointer to buffer where data will be copied from
+**            len(IN)     - length of buffer data, RODBI_VCOL_NULL when NULL
 **
-** Exception: Fatal error when accessing beyond memory
+** Exception: Sets nomem_rodbiStrm when memory cannot be allocated.
 **
 ** Returns:   None.
 **
 */
-#define RODBI_GET_VAR_DATA_ITEM_BY_REF(hdl, data, len, res)                   \
+#define RODBI_ADD_VAR_DATA_ITEM(arena, data, len)                             \
 do                                                                            \
 {                                                                             \
-  rodbivcol *col;                                                             \
-                                                                              \
-  if (((hdl)->offset_rodbichdl + (int)sizeof(rodbivcol)) > (hdl)->pgsize_rodbichdl)\
-  {                                                                           \
-    if ((hdl)->currpg_rodbichdl->next_rodbiPg)                                \
-      (hdl)->currpg_rodbichdl = (hdl)->currpg_rodbichdl->next_rodbiPg;        \
-    else                                                                      \
-      RODBI_FATAL(__func__, 1, (res)->state_rodbiRes);                    \
-    (hdl)->offset_rodbichdl = 0;                                              \
-  }                                                                           \
-                                                                              \
-  col=(rodbivcol *)                                                           \
-             &((hdl)->currpg_rodbichdl->buf_rodbiPg[(hdl)->offset_rodbichdl]);\
-  if (col->flag_rodbivcol & RODBI_VCOL_FLG_ELEM_REF_ACCESS)                   \
-  {                                                                           \
-    if (col->flag_rodbivcol & RODBI_VCOL_FLG_ELEM_IN_NEXT_PG)                 \
-    {                                                                         \
-      (hdl)->offset_rodbichdl = 0;                                            \
-      (hdl)->currpg_rodbichdl = (hdl)->currpg_rodbichdl->next_rodbiPg;        \
-      *data = (void *)&((hdl)->currpg_rodbichdl->buf_rodbiPg[0]);             \
-    }                                                                         \
-    else                                                                      \
-    {                                                                         \
-      (hdl)->offset_rodbichdl += offsetof(struct rodbivcol, dat_rodbivcol);   \
-      *data = (void *)(&col->dat_rodbivcol[0]);                               \
-    }                                                                         \
-                                                                              \
-    if (col->flag_rodbivcol & RODBI_VCOL_FLG_NULL)                            \
-      (*len) = RODBI_VCOL_NULL;                                               \
-    else                                                                      \
-    {                                                                         \
-      (*len) = col->len_rodbivcol;                                            \
-      (hdl)->offset_rodbichdl += (*len);                                      \
-    }                                                                         \
-                                                                              \
-    /* align offset to 4 or 8 byte boundary to access next item */            \
-    (hdl)->offset_rodbichdl += (sizeof(char *) -                              \
-                                 (hdl->offset_rodbichdl % sizeof(char *)));   \
-  }                                                                           \
-  else                                                                        \
-    (*len) = RODBI_VCOL_NO_REF;                                               \
-} while(0)
+  int vlen_ = (len);                                                          \
+  RODBI_ADD_FIXED_DATA_ITEM((arena), int, vlen_);                             \
+  if (vlen_ > 0)                                                              \
+    rodbiArenaAdd(&(arena)->var_rodbiArena, (data), (size_t)vlen_, 1);        \
+} while (0)
 
 
 static SEXP rodbiUDTInfoFields(SEXP list, roociObjType *objtyp,
@@ -1089,17 +1140,80 @@ static void rodbiDrvFree(rodbiDrv *drv);
 /* get connection id */
 static rodbiCon *rodbiGetCon(SEXP hdlCon);
 
+/* ------------------------- rodbiConWait --------------------------------- */
+/* wait for background fetches and asynchronous statements on connection */
+static void rodbiConWait(rodbiCon *con, boolean cancel);
+
 /* ------------------------- rodbiConInfoResults -------------------------- */
 /* get result set information related to connection */
 static SEXP rodbiConInfoResults(SEXP con);
 
+/* ------------------------- rodbiConLoadFail ----------------------------- */
+/* abort a direct path load and report its error */
+static void rodbiConLoadFail(rodbiCon *con, roociDirPath *pdp, sword status,
+                             int beg, int end);
+
+/* ------------------------- rodbiConParWait ------------------------------ */
+/* wait for a worker session of a parallel write */
+static void rodbiConParWait(rodbiCon *con, int wid, int nrow);
+
+/* ------------------------- rodbiConParPlain ----------------------------- */
+/* can the binds of data be copied without calls to the Oracle client? */
+static boolean rodbiConParPlain(rodbiCon *con, SEXP statement, SEXP data,
+                                ub1 qry_encoding);
+
+/* ------------------------- rodbiConParFail ------------------------------ */
+/* end a parallel write and report the error of a worker session */
+static void rodbiConParFail(rodbiCon *con, int wid, sword status, int beg,
+                            int end);
+
+/* ------------------------- rodbiConParFree ------------------------------ */
+/* roll back and close the worker sessions of a parallel write */
+static void rodbiConParFree(rodbiCon *con);
+
+/* ------------------------- rodbiQrysStart ------------------------------- */
+/* prepare a statement on an idle connection and start its worker */
+static void rodbiQrysStart(rodbiQry *qry, int qid);
+
+/* ------------------------- rodbiQrysWork -------------------------------- */
+/* worker thread executing and fetching a query, no R calls */
+static void rodbiQrysWork(void *ctx);
+
+/* ------------------------- rodbiQrysFetch ------------------------------- */
+/* fetch all rows of a query into the column arenas, no R calls */
+static sword rodbiQrysFetch(rodbiRes *res);
+
+/* ------------------------- rodbiQrysRun --------------------------------- */
+/* start statements and output the finished ones until all are done */
+static SEXP rodbiQrysRun(void *ctx);
+
+/* ------------------------- rodbiQrysOutput ------------------------------ */
+/* make the data frame of a finished query */
+static void rodbiQrysOutput(rodbiQry *qry);
+
+/* ------------------------- rodbiQrysFree -------------------------------- */
+/* break running queries and free them, also on error or interrupt */
+static void rodbiQrysFree(void *ctx, Rboolean jump);
+
 /* ----------------------------- rodbiConTerm ----------------------------- */
 static void rodbiConTerm(rodbiCon *con);
 
+/* ------------------------- rodbiGetPool --------------------------------- */
+/* get session pool pointer */
+static rodbiPool *rodbiGetPool(SEXP hdlPool);
+
+/* ------------------------- rodbiPoolTerm -------------------------------- */
+/* close the connections of a session pool and destroy it */
+static void rodbiPoolTerm(rodbiPool *pool);
+
 /* -------------------------- rodbiGetRes --------------------------------- */
 /* get result set ID */
 static rodbiRes *rodbiGetRes(SEXP hdlRes);
 
+/* -------------------------- rodbiGetResAsync ---------------------------- */
+/* get result set ID without waiting for a statement running on connection */
+static rodbiRes *rodbiGetResAsync(SEXP hdlRes);
+
 /* ------------------------- rodbiResExecStmt ----------------------------- */
 /* execute statement other than SELECT statement */
 static void rodbiResExecStmt(rodbiRes *res, SEXP data, boolean free_res);
@@ -1116,6 +1230,15 @@ static boolean rodbiIsVectorBind(SEXP data, SEXP vec, SEXP elem,
 /* bind input data and execute query */
 static void rodbiResExecBind(rodbiRes *res, SEXP data, boolean free_res);
 
+/* ------------------------- rodbiResExecPipe ----------------------------- */
+/* execute DML with bind copy of a chunk overlapping execute of the previous */
+static void rodbiResExecPipe(rodbiRes *res, SEXP data, boolean free_res);
+
+/* ------------------------- rodbiResExecFail ----------------------------- */
+/* report failure of a chunk executed in background with its rows */
+static void rodbiResExecFail(rodbiRes *res, sword status, int beg, int end,
+                             boolean free_res);
+
 /* ------------------------- rodbiResBind --------------------------------- */
 /* bind input data */
 static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
@@ -1129,7 +1252,42 @@ static void rodbiPlsqlResBind(rodbiRes *res, SEXP data, int bulk_write,
 /* ------------------------ rodbiResBindCopy ------------------------------ */
 /* bind data */
 static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
-                             boolean free_res);
+                             boolean rebind, boolean free_res);
+
+/* ----------------------- rodbiBindDirect -------------------------------- */
+/* can a bind use the R vector as its bind buffer */
+static boolean rodbiBindDirect(rodbiRes *res, int bid, SEXP vec);
+
+/* ----------------------- rodbiResBindDirect ----------------------------- */
+/* fill indicators of a chunk of an R vector bound in place */
+static void rodbiResBindDirect(rodbiRes *res, int bid, SEXP vec, int beg,
+                               int end);
+
+/* ----------------------- rodbiResBindPack ------------------------------- */
+/* size a string bind buffer for a chunk of an R vector */
+static void rodbiResBindPack(rodbiRes *res, int bid, SEXP vec, int beg,
+                             int end, boolean free_res);
+
+/* ----------------------- rodbiResBindAt --------------------------------- */
+/* bind at the buffers of a copied chunk */
+static void rodbiResBindAt(rodbiRes *res, int bid, SEXP vec, int beg,
+                           ub1 form_of_use, boolean free_res);
+
+/* ----------------------- rodbiResBindPipe ------------------------------- */
+/* can bind copy overlap execute in background */
+static boolean rodbiResBindPipe(rodbiRes *res, SEXP data);
+
+/* ----------------------- rodbiResBindPlain ------------------------------ */
+/* can binds be copied without OCI calls */
+static boolean rodbiResBindPlain(rodbiRes *res);
+
+/* ----------------------- rodbiResBindDate ------------------------------- */
+/* bind DATE columns that need fractional seconds as TIMESTAMP */
+static void rodbiResBindDate(rodbiRes *res, SEXP data, boolean free_res);
+
+/* ----------------------- rodbiResBindGrow ------------------------------- */
+/* grow bind buffers for data of execute that does not fit them */
+static void rodbiResBindGrow(rodbiRes *res, SEXP data, boolean free_res);
 
 /* ----------------------- rodbiResAlloc ---------------------------------- */
 /* get information of output result set */
@@ -1143,14 +1301,66 @@ static void rodbiResExpand(rodbiRes *res);
 /* split result set */
 static void rodbiResSplit(rodbiRes *res);
 
+/* ---------------------- rodbiResKernel ---------------------------------- */
+/* select accumulation kernel of each column after define */
+static void rodbiResKernel(rodbiRes *res);
+
+/* ---------------------- rodbiResKernelSel ------------------------------- */
+/* select kernels without R calls, returns ROOCI_DRV_ERR_MEM_FAIL on error */
+static sword rodbiResKernelSel(rodbiRes *res);
+
+/* ---------------------- rodbiResDirect ---------------------------------- */
+/* point fixed width column defines at R vectors for the next fetch */
+static void rodbiResDirect(rodbiRes *res);
+
+/* ---------------------- rodbiSCacheReset -------------------------------- */
+/* drop CHARSXPs cached by a previous fetch */
+static void rodbiSCacheReset(rodbiRes *res);
+
+/* ---------------------- rodbiSCacheMkChar ------------------------------- */
+/* make CHARSXP reusing a cached one for repeated values */
+static SEXP rodbiSCacheMkChar(rodbiSCache *sc, const char *dat, int len,
+                              cetype_t enc);
+
+/* ---------------------- rodbiStrHash ------------------------------------ */
+/* hash bytes of a string value */
+static ub4 rodbiStrHash(const char *dat, int len);
+
+/* ---------------------- rodbiDictCode ----------------------------------- */
+/* get factor code of a value, adding a level for a new value */
+static int rodbiDictCode(rodbiDict *dict, const char *dat, int len);
+
+/* ---------------------- rodbiDictLevels --------------------------------- */
+/* make levels vector of a factor dictionary */
+static SEXP rodbiDictLevels(rodbiDict *dict, cetype_t enc);
+
+/* ---------------------- rodbiDictFree ----------------------------------- */
+/* free levels of a factor dictionary */
+static void rodbiDictFree(rodbiDict *dict);
+
 /* ---------------------- rodbiResAccum ----------------------------------- */
 /* accumulate result set */
 static void rodbiResAccum(rodbiRes *res);
 
+/* ---------------------- rodbiResAccumKernel ----------------------------- */
+/* accumulate a column using its specialized kernel */
+static void rodbiResAccumKernel(rodbiRes *res, int cid, SEXP vec,
+                                cetype_t enc, char **tempbuf,
+                                size_t *tempbuflen);
+
 /* ---------------------- rodbiResAccumInCache ---------------------------- */
 /* accumulate result set in ROracle cache */
 static void rodbiResAccumInCache(rodbiRes *res);
 
+/* ------------------- rodbiResAccumInCacheKernel ------------------------- */
+/* accumulate a column in ROracle cache using its specialized kernel */
+static sword rodbiResAccumInCacheKernel(rodbiRes *res, int cid,
+                                        rodbiArena *arena);
+
+/* ---------------------- rodbiNextNull ----------------------------------- */
+/* find the next NULL indicator in a fetched batch */
+static int rodbiNextNull(const sb2 *ind, int beg, int end);
+
 /* ---------------------- rodbiResTrim ------------------------------------ */
 /* trim result set column vector  */
 static void rodbiResTrim(rodbiRes *res);
@@ -1179,57 +1389,55 @@ static SEXP rodbiResInfoStmt(rodbiRes *res);
 /* get result set fields information */
 static SEXP rodbiResInfoFields(rodbiRes *res);
 
+/* --------------------- rodbiResInfoBatch -------------------------------- */
+/* get rows in error of array DML with batch errors */
+static SEXP rodbiResInfoBatch(rodbiRes *res);
+
+/* --------------------- rodbiResAsyncWork -------------------------------- */
+/* worker thread executing an asynchronous statement, no R calls */
+static void rodbiResAsyncWork(void *ctx);
+
+/* --------------------- rodbiResAsyncDone -------------------------------- */
+/* has the worker of an asynchronous statement finished */
+static boolean rodbiResAsyncDone(rodbiRes *res);
+
+/* --------------------- rodbiResAsyncJoin -------------------------------- */
+/* wait for an asynchronous statement, or break it */
+static void rodbiResAsyncJoin(rodbiRes *res, boolean cancel);
+
+/* --------------------- rodbiResAsyncWait -------------------------------- */
+/* wait for an asynchronous statement and report its error, or break it */
+static void rodbiResAsyncWait(rodbiRes *res, boolean cancel);
+
 /* ------------------------------- rodbiResTerm ---------------------------- */
 /* Terminate the result and free memory */
 static void rodbiResTerm(rodbiRes  *res);
 
+/* ------------------------------- rodbiResFree ---------------------------- */
+/* Free memory of a result whose OCI result is already freed */
+static void rodbiResFree(rodbiRes  *res);
+
 /* --------------------- rodbiCheck --------------------------------------- */
 /* get error message and throw error */
 static void rodbiCheck(rodbiDrv *drv, rodbiCon *con, const char *fun,
                        int pos, sword status, text *errMsg, size_t errMsgLen);
 
-/*
-** Name:      RODBI_ADD_VAR_DATA_ITEM - ROracle DBI ADD a VARiable length DATA
-**                                      ITEM to page table
-**
-** Function:  This function adds a variable length data item into the paged
-**            memory at the current offset. Current offset is incremented to add
-**            the next item. Before adding an item it expands the page table when
-**            the item does not fit in the page adjusting the current offset.
-**            It tracks the maximum length of an item added in the paged table.
-**
-** Input:     hdl(IN)      - address of rodbichdl
-**            flag(IN)     - RODBI_VCOL_FLG_NULL when NULL data or 
-**                           RODBI_VCOL_FLG_NOTNULL when data is not NULL
-**            data(IN)     - pointer to buffer where data will be copied from
-**            len(IN)      - length of buffer data
-**
-** Exception: Fatal error when memory cannot be allocated.
-**
-** Returns:   None.
-**
-*/
-static sword RODBI_ADD_VAR_DATA_ITEM(rodbichdl *hdl, ub1 flag,
-                                     void *data, int len);
+/* --------------------- rodbiArenaAdd ------------------------------------ */
+/* append items to a column arena stream */
+static void rodbiArenaAdd(rodbiStrm *strm, const void *data, size_t siz,
+                          int cnt);
 
-/*
-** Name:      RODBI_GET_VAR_DATA_ITEM - ROracle DBI GET a VARiable DATA ITEM from
-**                                      page table at current offset
-**
-** Function:  This function copies a variable length data item from paged memory
-**            at the current offset into address pointed by data. Current offset
-**            is incremented to get the next item.
-**
-** Input:     hdl(IN)      - address of rodbichdl
-**            data(IN)     - pointer to buffer where data will be copied to
-**            len(IN)      - length of buffer data
-**
-** Exception: None.
-**
-** Returns:   0 on success and ROOCI_DRV_ERR_NO_DATA if there is no data.
-**
-*/
-static int RODBI_GET_VAR_DATA_ITEM(rodbichdl *hdl, void *data, int len);
+/* --------------------- rodbiArenaCopy ----------------------------------- */
+/* copy a fixed width column arena stream into contiguous memory */
+static void rodbiArenaCopy(rodbiStrm *strm, void *dst);
+
+/* --------------------- rodbiArenaNextVar -------------------------------- */
+/* get the next variable length item from a column arena stream */
+static ub1 *rodbiArenaNextVar(rodbiStrm *strm, int len);
+
+/* --------------------- rodbiArenaFree ----------------------------------- */
+/* free all chunks of a column arena */
+static void rodbiArenaFree(rodbiArena *arena);
 
 /* ----------------------------- rociDrvAlloc ----------------------------- */
 /* create external pointer of driver */
@@ -1239,7 +1447,7 @@ SEXP rociDrvAlloc(void);
 /* Initialize driver  context */
 SEXP rociDrvInit(SEXP ptrDrv, SEXP interruptible, SEXP ptrEpx,
                  SEXP unicode_as_utf8, SEXP ora_attributes,
-                 SEXP ora_objects, SEXP sparse);
+                 SEXP ora_objects, SEXP sparse, SEXP threaded);
 
 /* ----------------------------- rociDrvInfo ------------------------------ */
 /* get driver info */
@@ -1253,7 +1461,13 @@ SEXP rociDrvTerm(SEXP ptrDrv);
 /* initialize connection context */
 SEXP rociConInit(SEXP ptrDrv, SEXP params, SEXP prefetch, SEXP nrows,
                  SEXP nrows_write, SEXP stmtCacheSize,
-                 SEXP external_credentials, SEXP sysdba);
+                 SEXP external_credentials, SEXP sysdba, SEXP purity,
+                 SEXP drop_session, SEXP keep_credentials);
+
+/* ---------------------------- rociConPool ------------------------------- */
+/* initialize connection context with a session of a pool */
+SEXP rociConPool(SEXP hdlPool, SEXP prefetch, SEXP nrows, SEXP nrows_write,
+                 SEXP cclass, SEXP purity, SEXP drop_session);
 
 /* ---------------------------- rociConError ------------------------------ */
 /* get connection error */
@@ -1275,10 +1489,37 @@ SEXP rociConCommit(SEXP hdlCon);
 /* rollback connection transaction */
 SEXP rociConRollback(SEXP hdlCon);
 
+/* ---------------------------- rociConDirPath ---------------------------- */
+/* load data frame into a table with direct path */
+SEXP rociConDirPath(SEXP hdlCon, SEXP schema, SEXP table, SEXP cnames,
+                    SEXP data);
+
+/* ---------------------------- rociConWritePar --------------------------- */
+/* execute DML over the rows of data frame in parallel sessions */
+SEXP rociConWritePar(SEXP hdlCon, SEXP statement, SEXP data, SEXP workers);
+
+/* ---------------------------- rociConQueries ---------------------------- */
+/* run a query on each connection at the same time */
+SEXP rociConQueries(SEXP hdlCons, SEXP statements, SEXP prefetch, SEXP nrows,
+                    SEXP nbytes);
+
+/* ---------------------------- rociPoolInit ------------------------------ */
+/* create session pool */
+SEXP rociPoolInit(SEXP ptrDrv, SEXP params, SEXP sizes, SEXP stmtCacheSize);
+
+/* ---------------------------- rociPoolInfo ------------------------------ */
+/* get session pool info */
+SEXP rociPoolInfo(SEXP hdlPool);
+
+/* ---------------------------- rociPoolTerm ------------------------------ */
+/* destroy session pool */
+SEXP rociPoolTerm(SEXP hdlPool);
+
 /* ---------------------------- rociResInit ------------------------------- */
 /* initialize result set */
 SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
-                 SEXP prefetch, SEXP nrows, SEXP nrows_write, SEXP sparse);
+                 SEXP prefetch, SEXP nrows, SEXP nrows_write, SEXP sparse,
+                 SEXP nbytes, SEXP pipeline, SEXP batch_errors);
 
 /* --------------------------- rociResExec -------------------------------- */
 /* execute statement */
@@ -1288,6 +1529,31 @@ SEXP rociResExec(SEXP hdlRes, SEXP data);
 /* fetch result */
 SEXP rociResFetch(SEXP hdlRes, SEXP numRec);
 
+/* --------------------------- rociResFactors ----------------------------- */
+/* set character columns to be fetched as factors */
+SEXP rociResFactors(SEXP hdlRes, SEXP factors);
+
+/* --------------------------- rociResPipeline ---------------------------- */
+/* fetch the next batch in a background thread */
+SEXP rociResPipeline(SEXP hdlRes, SEXP pipeline);
+
+/* --------------------------- rociResAsync ------------------------------- */
+/* execute statement in a worker thread */
+SEXP rociResAsync(SEXP hdlCon, SEXP statement, SEXP prefetch, SEXP nrows,
+                  SEXP nbytes);
+
+/* --------------------------- rociResReady ------------------------------- */
+/* is asynchronous statement done */
+SEXP rociResReady(SEXP hdlRes);
+
+/* --------------------------- rociResAwait ------------------------------- */
+/* wait for asynchronous statement up to timeout seconds */
+SEXP rociResAwait(SEXP hdlRes, SEXP timeout);
+
+/* --------------------------- rociResCancel ------------------------------ */
+/* break asynchronous statement */
+SEXP rociResCancel(SEXP hdlRes);
+
 /* --------------------------- rociResInfo -------------------------------- */
 SEXP rociResInfo(SEXP hdlRes);
 
@@ -1329,7 +1595,7 @@ SEXP rociDrvAlloc(void)
 
 SEXP rociDrvInit(SEXP ptrDrv, SEXP interruptible, SEXP ptrEpx,
                  SEXP unicode_as_utf8, SEXP ora_attributes,
-                 SEXP ora_objects, SEXP sparse)
+                 SEXP ora_objects, SEXP sparse, SEXP threaded)
 {
   rodbiDrv  *drv = R_ExternalPtrAddr(ptrDrv);
   void      *epx = isNull(ptrEpx) ? NULL : R_ExternalPtrAddr(ptrEpx);
@@ -1376,7 +1642,7 @@ fprintf(stdout, "rodbi: Extproc driver epx=%p\n", epx);
                roociInitializeCtx(&(drv->ctx_rodbiDrv), epx,
                                   *LOGICAL(interruptible),
                                   *LOGICAL(unicode_as_utf8),
-                                  (isObject)));
+                                  (isObject), *LOGICAL(threaded)));
 
   /* set external pointer */
   R_SetExternalPtrAddr(ptrDrv, drv);
@@ -1403,12 +1669,10 @@ SEXP rociDrvInfo(SEXP ptrDrv)
   SEXP      names;
 
   /* allocate output list */
-  PROTECT(info = allocVector(VECSXP, 9));
-//PROTECT(info = allocVector(VECSXP, 10));
+  PROTECT(info = allocVector(VECSXP, 10));
 
   /* allocate list element names */
-  names = allocVector(STRSXP, 9);
-//names = allocVector(STRSXP, 10);
+  names = allocVector(STRSXP, 10);
   setAttrib(info, R_NamesSymbol, names);                  /* protects names */
 
   /* driverName */
@@ -1456,11 +1720,15 @@ SEXP rociDrvInfo(SEXP ptrDrv)
   SET_VECTOR_ELT(info,  8, rodbiDrvInfoConnections(drv));
   SET_STRING_ELT(names, 8, mkChar("connections"));
 
+  /* threaded */
+  SET_VECTOR_ELT(info,  9, ScalarLogical(drv->ctx_rodbiDrv.threaded_roociCtx));
+  SET_STRING_ELT(names, 9, mkChar("threaded"));
+
 ///* ROracle compiled with Oracle client */
 //snprintf(version, ROOCI_VERSION_LEN, "%d",
 //         drv->ctx_rodbiDrv.compiled_maj_roociCtx);
-//SET_VECTOR_ELT(info,  9, mkString(version));
-//SET_STRING_ELT(names, 9, mkChar("compiledVersion"));
+//SET_VECTOR_ELT(info, 10, mkString(version));
+//SET_STRING_ELT(names, 10, mkChar("compiledVersion"));
 
   /* release info list */
   UNPROTECT(1);
@@ -1495,11 +1763,13 @@ SEXP rociDrvTerm(SEXP ptrDrv)
 
 SEXP rociConInit(SEXP ptrDrv, SEXP params, SEXP prefetch, SEXP nrows,
                  SEXP nrows_write, SEXP stmtCacheSize,
-                 SEXP external_credentials, SEXP sysdba)
+                 SEXP external_credentials, SEXP sysdba, SEXP purity,
+                 SEXP drop_session, SEXP keep_credentials)
 {
   char       *user             = (char *)CHAR(STRING_ELT(params, 0));
   char       *pass             = (char *)CHAR(STRING_ELT(params, 1));
   char       *conStr           = (char *)CHAR(STRING_ELT(params, 2));
+  char       *cclass           = (char *)CHAR(STRING_ELT(params, 3));
   rodbiDrv   *drv              = rodbiGetDrv(ptrDrv);
   rodbiCon   *con;
   SEXP        hdlCon;
@@ -1543,9 +1813,13 @@ SEXP rociConInit(SEXP ptrDrv, SEXP params, SEXP prefetch, SEXP nrows,
                                        &(con->con_rodbiCon),
                                        user, pass, conStr,
                                        (ub4)INTEGER(stmtCacheSize)[0],
-                                       sess_mod)); 
+                                       sess_mod, cclass,
+                                       RODBI_PURITY(purity), NULL,
+                                       *LOGICAL(keep_credentials)));
 
     (con->con_rodbiCon).parent_roociCon = con;
+    (con->con_rodbiCon).rlsmode_roociCon = *LOGICAL(drop_session) ?
+                                           OCI_SESSRLS_DROPSESS : OCI_DEFAULT;
     con->ociprefetch_rodbiCon           = (*LOGICAL(prefetch) == TRUE) ? 
                                                                   TRUE : FALSE;
     con->nrows_rodbiCon                 = INTEGER(nrows)[0];
@@ -1563,6 +1837,52 @@ SEXP rociConInit(SEXP ptrDrv, SEXP params, SEXP prefetch, SEXP nrows,
   return hdlCon;
 } /* end rociConInit */
 
+/* ----------------------------- rociConPool ------------------------------ */
+
+SEXP rociConPool(SEXP hdlPool, SEXP prefetch, SEXP nrows, SEXP nrows_write,
+                 SEXP cclass, SEXP purity, SEXP drop_session)
+{
+  rodbiPool  *pool  = rodbiGetPool(hdlPool);
+  rodbiDrv   *drv   = pool->drv_rodbiPool;
+  roociPool  *ppool = &(pool->pool_rodbiPool);
+  rodbiCon   *con;
+  SEXP        hdlCon;
+
+  /* allocate rodbi connection */
+  ROOCI_MEM_ALLOC(con, 1, sizeof(rodbiCon));
+  if (!con)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+
+  con->drv_rodbiCon = drv;
+
+  /* take a session of the pool, it is already logged on */
+  RODBI_CHECK_CON(con, __func__, 1, FALSE,
+                  roociInitializeCon(&drv->ctx_rodbiDrv,
+                                     &(con->con_rodbiCon), NULL, NULL,
+                                     ppool->cstr_roociPool,
+                                     ppool->scache_roociPool, OCI_DEFAULT,
+                                     (char *)CHAR(STRING_ELT(cclass, 0)),
+                                     RODBI_PURITY(purity), ppool, FALSE));
+
+  (con->con_rodbiCon).parent_roociCon  = con;
+  (con->con_rodbiCon).rlsmode_roociCon = *LOGICAL(drop_session) ?
+                                         OCI_SESSRLS_DROPSESS : OCI_DEFAULT;
+  con->ociprefetch_rodbiCon           = (*LOGICAL(prefetch) == TRUE) ? 
+                                                                  TRUE : FALSE;
+  con->nrows_rodbiCon                 = INTEGER(nrows)[0];
+  con->nrows_write_rodbiCon           = INTEGER(nrows_write)[0];
+
+  /* allocate connection handle */
+  hdlCon = R_MakeExternalPtr((void *)con, R_NilValue, R_NilValue);
+
+  /* set connection magic word */
+  con->magicWord_rodbiCon = RODBI_CHECKWD;
+
+  RODBI_TRACE("connection taken from pool");
+
+  return hdlCon;
+} /* end rociConPool */
+
 /* ----------------------------- rociConError ----------------------------- */
 
 SEXP rociConError(SEXP hdlCon)
@@ -1709,7 +2029,13 @@ SEXP rociConInfo(SEXP hdlCon)
 
 SEXP rociConTerm(SEXP hdlCon)
 {
-  rodbiCon  *con = rodbiGetCon(hdlCon);
+  rodbiCon  *con = R_ExternalPtrAddr(hdlCon);
+
+  /* check validity, a statement still running on it is broken */
+  if (con && rodbiAssertCon(con, __func__, 1))
+    rodbiConWait(con, TRUE);
+  else
+    con = NULL;
 
   if (con)
   {
@@ -1769,43 +2095,649 @@ SEXP rociConRollback(SEXP hdlCon)
   return R_NilValue;
 } /* end rociConRollback */
 
-/****************************************************************************/
-/*  (*) RESULT FUNCTIONS                                                    */
-/****************************************************************************/
+/* ------------------------------ rociConDirPath --------------------------- */
 
+SEXP rociConDirPath(SEXP hdlCon, SEXP schema, SEXP table, SEXP cnames,
+                    SEXP data)
+{
+  rodbiCon      *con  = rodbiGetCon(hdlCon);
+  roociCon      *pcon = &(con->con_rodbiCon);
+  roociDirPath   dp;
+  int            ncol = LENGTH(data);
+  int            nrow = ncol ? LENGTH(VECTOR_ELT(data, 0)) : 0;
+  const char   **names;
+  ub2           *types;
+  ub4           *sizes;
+  ub2           *csids;
+  const void    *vmax;
+  int            cid;
+  int            beg;
+  int            end;
+  int            i;
+  int            utf8;
+  ub4            done;
+  sword          rc;
 
-/* ------------------------------ rociResInit ----------------------------- */
+  memset(&dp, 0, sizeof(dp));
 
-SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
-                 SEXP prefetch, SEXP nrows, SEXP nrows_write, SEXP sparse)
-{
-  rodbiCon   *con             = rodbiGetCon(hdlCon);
-  rodbiRes   *res;
-  SEXP        hdlRes;
-  boolean     pref;
-  int         rows_per_fetch;
-  int         rows_per_write;
-  cetype_t    enc;                                 /* encoding of statement */
-  ub1         qry_encoding    = CE_NATIVE;
-  ub4         stmt_cache_size = 0;
-  int         bid;
+  /* freed by R on return or error */
+  names = (const char **)R_alloc(ncol, sizeof(char *));
+  types = (ub2 *)R_alloc(ncol, sizeof(ub2));
+  sizes = (ub4 *)R_alloc(ncol, sizeof(ub4));
+  csids = (ub2 *)R_alloc(ncol, sizeof(ub2));
 
-  pref = ((*LOGICAL(prefetch) == TRUE) ? TRUE :
-                                        (con->ociprefetch_rodbiCon ? TRUE : 
-                                                                     FALSE));
-  /* There is some problem with statement cache and prefetch = FALSE optons.
-     Hence blocking this combination for time being. */
-  RODBI_CHECK_CON(con, __func__, 1, FALSE,
-                  roociGetConInfo(&con->con_rodbiCon, NULL, NULL, NULL, 
-                                  &stmt_cache_size));
+  /* column types are those of the R vectors, so values need no copy */
+  for (cid = 0; cid < ncol; cid++)
+  {
+    SEXP  vec = VECTOR_ELT(data, cid);
 
-  if (pref == FALSE && stmt_cache_size > 0)
-    RODBI_ERROR(RODBI_ERR_PREF_STMT_CACHE);
+    names[cid] = CHAR(STRING_ELT(cnames, cid));
+    csids[cid] = 0;
+    sizes[cid] = 1;
 
-  /* allocate rodbi result */
-  ROOCI_MEM_ALLOC(res, 1, sizeof(rodbiRes));
-  if (!res)
-    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+    switch (TYPEOF(vec))
+    {
+    case REALSXP:
+      types[cid] = SQLT_FLT;
+      sizes[cid] = (ub4)sizeof(double);
+      break;
+
+    case INTSXP:
+    case LGLSXP:
+      types[cid] = SQLT_INT;
+      sizes[cid] = (ub4)sizeof(int);
+      break;
+
+    case STRSXP:
+      /* UTF-8 column if its first value is, same as a bind */
+      types[cid] = SQLT_CHR;
+      for (i = 0, utf8 = -1; i < nrow; i++)
+      {
+        SEXP  str = STRING_ELT(vec, i);
+        ub4   len;
+
+        if (str == NA_STRING)
+          continue;
+        if (utf8 < 0)
+          utf8 = (Rf_getCharCE(str) == CE_UTF8);
+
+        /* other values converted to UTF-8 take at most 3 bytes a char */
+        len = (ub4)LENGTH(str);
+        if (utf8 && (Rf_getCharCE(str) != CE_UTF8))
+          len *= 3;
+        if (len > sizes[cid])
+          sizes[cid] = len;
+      }
+      if (utf8 > 0)
+        csids[cid] = RODBI_CSID_AL32UTF8;
+      break;
+
+    case VECSXP:
+      types[cid] = SQLT_BIN;
+      for (i = 0; i < nrow; i++)
+      {
+        SEXP  x = VECTOR_ELT(vec, i);
+
+        if (isNull(x))
+          continue;
+        if (TYPEOF(x) != RAWSXP)
+          RODBI_ERROR(RODBI_ERR_UNSUPP_BIND_TYPE);
+        if ((ub4)LENGTH(x) > sizes[cid])
+          sizes[cid] = (ub4)LENGTH(x);
+      }
+      break;
+
+    default:
+      RODBI_ERROR(RODBI_ERR_UNSUPP_BIND_TYPE);
+    }
+  }
+
+  rc = roociDirPathInit(pcon, &dp,
+                        isNull(schema) ? NULL : CHAR(STRING_ELT(schema, 0)),
+                        CHAR(STRING_ELT(table, 0)), (ub2)ncol, names, types,
+                        sizes, csids, (ub4)con->nrows_write_rodbiCon);
+  if (rc != OCI_SUCCESS)
+    rodbiConLoadFail(con, &dp, rc, 0, 0);
+
+  for (beg = 0; beg < nrow; beg = end)
+  {
+    end  = ((nrow - beg) > (int)dp.nrows_roociDirPath) ?
+                                beg + (int)dp.nrows_roociDirPath : nrow;
+    vmax = vmaxget();
+
+    /* point column array entries at the values in the R vectors */
+    for (cid = 0; cid < ncol; cid++)
+    {
+      SEXP  vec = VECTOR_ELT(data, cid);
+
+      for (i = beg; i < end; i++)
+      {
+        ub1  *dat = NULL;
+        ub4   len = 0;
+        ub1   flg = OCI_DIRPATH_COL_NULL;
+
+        if (TYPEOF(vec) == REALSXP)
+        {
+          if (!ISNA(REAL(vec)[i]))
+          {
+            dat = (ub1 *)(REAL(vec) + i);
+            len = (ub4)sizeof(double);
+            flg = OCI_DIRPATH_COL_COMPLETE;
+          }
+        }
+        else if ((TYPEOF(vec) == INTSXP) || (TYPEOF(vec) == LGLSXP))
+        {
+          int  *val = ((TYPEOF(vec) == INTSXP) ? INTEGER(vec) :
+                                                 LOGICAL(vec)) + i;
+
+          if (*val != NA_INTEGER)
+          {
+            dat = (ub1 *)val;
+            len = (ub4)sizeof(int);
+            flg = OCI_DIRPATH_COL_COMPLETE;
+          }
+        }
+        else if (TYPEOF(vec) == STRSXP)
+        {
+          SEXP        str = STRING_ELT(vec, i);
+          const char *txt;
+
+          if (str != NA_STRING)
+          {
+            txt = csids[cid] ? translateCharUTF8(str) : translateChar(str);
+            dat = (ub1 *)txt;
+            len = (txt == CHAR(str)) ? (ub4)LENGTH(str) : (ub4)strlen(txt);
+            flg = OCI_DIRPATH_COL_COMPLETE;
+          }
+        }
+        else
+        {
+          SEXP  x = VECTOR_ELT(vec, i);
+
+          if (!isNull(x) && LENGTH(x))
+          {
+            dat = RAW(x);
+            len = (ub4)LENGTH(x);
+            flg = OCI_DIRPATH_COL_COMPLETE;
+          }
+        }
+
+        rc = roociDirPathSet(pcon, &dp, (ub4)(i - beg), (ub2)cid, dat, len,
+                             flg);
+        if (rc != OCI_SUCCESS)
+          rodbiConLoadFail(con, &dp, rc, i, i + 1);
+      }
+    }
+
+    /* convert and load this batch, then let R free translated strings */
+    rc = roociDirPathLoad(pcon, &dp, (ub4)(end - beg), &done);
+    if (rc != OCI_SUCCESS)
+      rodbiConLoadFail(con, &dp, rc, beg + (int)done, end);
+    vmaxset(vmax);
+  }
+
+  rc = roociDirPathFinish(pcon, &dp);
+  if (rc != OCI_SUCCESS)
+    rodbiConLoadFail(con, &dp, rc, 0, 0);
+  roociDirPathFree(pcon, &dp, FALSE);
+
+  return ScalarReal((double)nrow);
+} /* end rociConDirPath */
+
+/* ----------------------------- rociConWritePar --------------------------- */
+
+SEXP rociConWritePar(SEXP hdlCon, SEXP statement, SEXP data, SEXP workers)
+{
+  rodbiCon   *con   = rodbiGetCon(hdlCon);
+  rodbiDrv   *drv   = con->drv_rodbiCon;
+  roociCon   *pcon  = &(con->con_rodbiCon);
+  rodbiPar   *par;
+  int         nrow  = LENGTH(VECTOR_ELT(data, 0));
+  int         chunk = con->nrows_write_rodbiCon;
+  int         nwrk  = INTEGER(workers)[0];
+  cetype_t    enc   = Rf_getCharCE(STRING_ELT(statement, 0));
+  ub1         qry_encoding;
+  int         nchk;
+  int         wid;
+  int         beg;
+  int         end;
+  int         off;
+  boolean     more;
+  sword       rc;
+
+  if (!nrow || (nwrk < 2))
+    return ScalarLogical(FALSE);
+
+  /* every case left to this session below is reported */
+  if (drv->extproc_rodbiDrv)
+  {
+    RODBI_WARNING(RODBI_WAR_PAR_EXTPROC);
+    return ScalarLogical(FALSE);
+  }
+
+  /* sessions of the same user need its credentials */
+  if (!pcon->user_roociCon)
+  {
+    RODBI_WARNING(RODBI_WAR_PAR_CREDENTIALS);
+    return ScalarLogical(FALSE);
+  }
+
+  /* no more sessions than chunks of rows, a single chunk needs none */
+  nchk = (nrow + chunk - 1) / chunk;
+  if (nwrk > nchk)
+    nwrk = nchk;
+  if (nwrk < 2)
+  {
+    RODBI_WARNING(RODBI_WAR_PAR_ONE_CHUNK);
+    return ScalarLogical(FALSE);
+  }
+
+  qry_encoding = (enc == CE_UTF8)   ? ROOCI_QRY_UTF8   :
+                 (enc == CE_LATIN1) ? ROOCI_QRY_LATIN1 : ROOCI_QRY_NATIVE;
+
+  /* binds needing OCI calls to copy are left to this session, checked
+     before any worker session logs on */
+  if (!rodbiConParPlain(con, statement, data, qry_encoding))
+  {
+    RODBI_WARNING(RODBI_WAR_PAR_BIND);
+    return ScalarLogical(FALSE);
+  }
+
+  ROOCI_MEM_ALLOC(par, 1, sizeof(rodbiPar));
+  if (!par)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  con->par_rodbiCon = par;
+  par->cnt_rodbiPar = nwrk;
+  par->cmt_rodbiPar = -1;
+
+  ROOCI_MEM_ALLOC(par->con_rodbiPar,  nwrk, sizeof(rodbiCon));
+  ROOCI_MEM_ALLOC(par->res_rodbiPar,  nwrk, sizeof(rodbiRes));
+  ROOCI_MEM_ALLOC(par->thr_rodbiPar,  nwrk, sizeof(roociThrCtx));
+  ROOCI_MEM_ALLOC(par->rows_rodbiPar, nwrk, sizeof(ub4));
+  ROOCI_MEM_ALLOC(par->beg_rodbiPar,  nwrk, sizeof(int));
+  ROOCI_MEM_ALLOC(par->end_rodbiPar,  nwrk, sizeof(int));
+  if (!par->con_rodbiPar || !par->res_rodbiPar || !par->thr_rodbiPar ||
+      !par->rows_rodbiPar || !par->beg_rodbiPar || !par->end_rodbiPar)
+    rodbiConParFail(con, -1, ROOCI_DRV_ERR_MEM_FAIL, 0, 0);
+
+  /* each worker inserts a single range of whole chunks */
+  for (wid = 0; wid < nwrk; wid++)
+  {
+    end = (int)(((double)nchk * (wid + 1)) / nwrk) * chunk;
+    par->end_rodbiPar[wid] = (end > nrow) ? nrow : end;
+  }
+
+  /* workers execute at the same time, their environment is threaded */
+  rc = roociInitializeCtx(&par->ctx_rodbiPar, NULL, FALSE,
+                          drv->unicode_as_utf8, FALSE, TRUE);
+  if (rc != OCI_SUCCESS)
+    rodbiConParFail(con, -1, rc, 0, 0);
+
+  /* a session, prepared statement and bind buffers for each worker */
+  for (wid = 0; wid < nwrk; wid++)
+  {
+    rodbiCon  *wcon = &par->con_rodbiPar[wid];
+    rodbiRes  *wres = &par->res_rodbiPar[wid];
+
+    wcon->drv_rodbiCon         = drv;
+    wcon->nrows_write_rodbiCon = chunk;
+    rc = roociInitializeCon(&par->ctx_rodbiPar, &(wcon->con_rodbiCon),
+                            pcon->user_roociCon, pcon->pass_roociCon,
+                            pcon->cstr_roociCon, 0,
+                            pcon->mode_roociCon & ~OCI_SESSGET_STMTCACHE,
+                            pcon->cclass_roociCon, pcon->purity_roociCon,
+                            NULL, FALSE);
+    if (rc != OCI_SUCCESS)
+      rodbiConParFail(con, wid, rc, 0, 0);
+    (wcon->con_rodbiCon).parent_roociCon = wcon;
+    wcon->magicWord_rodbiCon             = RODBI_CHECKWD;
+
+    wres->con_rodbiRes = wcon;
+    rc = roociInitializeRes(&(wcon->con_rodbiCon), &(wres->res_rodbiRes),
+                            (oratext *)CHAR(STRING_ELT(statement, 0)),
+                            LENGTH(STRING_ELT(statement, 0)), qry_encoding,
+                            &(wres->styp_rodbiRes), TRUE, 1, chunk);
+    if (rc != OCI_SUCCESS)
+      rodbiConParFail(con, wid, rc, 0, 0);
+    (wres->res_rodbiRes).parent_roociRes = wres;
+    wres->magicWord_rodbiRes             = RODBI_CHECKWD;
+
+    rodbiResBind(wres, data, chunk, FALSE);
+    rodbiResBindDate(wres, data, FALSE);
+
+    /* same binds as checked on this session, unless a logon trigger set
+       another time zone */
+    if (!rodbiResBindPlain(wres))
+    {
+      rodbiConParFree(con);
+      RODBI_WARNING(RODBI_WAR_PAR_BIND);
+      return ScalarLogical(FALSE);
+    }
+  }
+  par->styp_rodbiPar = par->res_rodbiPar[0].styp_rodbiRes;
+
+  /* the next chunk of each worker is copied while the others execute */
+  for (off = 0, more = TRUE; more; off += chunk)
+  {
+    more = FALSE;
+    for (wid = 0; wid < nwrk; wid++)
+    {
+      rodbiRes  *wres = &par->res_rodbiPar[wid];
+
+      beg = (wid ? par->end_rodbiPar[wid - 1] : 0) + off;
+      if (beg >= par->end_rodbiPar[wid])
+        continue;
+      end = ((par->end_rodbiPar[wid] - beg) > chunk) ? beg + chunk :
+                                                       par->end_rodbiPar[wid];
+      more = TRUE;
+
+      /* the worker must be done with its last chunk before new binds */
+      rodbiConParWait(con, wid, nrow);
+
+      rodbiResBindCopy(wres, data, beg, end, TRUE, FALSE);
+      par->beg_rodbiPar[wid] = beg;
+
+      rc = roociThrExecStart(&par->thr_rodbiPar[wid], &(wres->res_rodbiRes),
+                             (ub4)(end - beg), par->styp_rodbiPar,
+                             &par->rows_rodbiPar[wid]);
+      if (rc != OCI_SUCCESS)
+        rodbiConParFail(con, wid, rc, beg, end);
+    }
+  }
+
+  for (wid = 0; wid < nwrk; wid++)
+    rodbiConParWait(con, wid, nrow);
+
+  /*
+  ** Every session succeeded, only now are the rows committed. The sessions
+  ** commit one after the other, so this is not atomic: when a commit fails
+  ** the sessions before it stay committed, and as they hold the leading
+  ** ranges of rows the error names the rows committed. An atomic append
+  ** of dbWriteTable points the statement at a scratch table instead.
+  */
+  for (wid = 0, par->cmt_rodbiPar = 0; wid < nwrk; wid++)
+  {
+    rc = roociCommitCon(&(par->con_rodbiPar[wid].con_rodbiCon));
+    if (rc != OCI_SUCCESS)
+      rodbiConParFail(con, wid, rc, 0, 0);
+    par->cmt_rodbiPar++;
+  }
+
+  rodbiConParFree(con);
+
+  return ScalarLogical(TRUE);
+} /* end rociConWritePar */
+
+/* ----------------------------- rociConQueries --------------------------- */
+
+SEXP rociConQueries(SEXP hdlCons, SEXP statements, SEXP prefetch, SEXP nrows,
+                    SEXP nbytes)
+{
+  int         ncon = LENGTH(hdlCons);
+  rodbiCon   *con  = rodbiGetCon(VECTOR_ELT(hdlCons, 0));
+  rodbiDrv   *drv  = con->drv_rodbiCon;
+  rodbiQrys  *qrys;
+  SEXP        out;
+  SEXP        cont;
+  ub4         stmt_cache_size;
+  boolean     pref = (*LOGICAL(prefetch) == TRUE) ? TRUE : FALSE;
+  int         cid;
+  int         i;
+  sword       status;
+
+  for (cid = 0; cid < ncon; cid++)
+  {
+    con = rodbiGetCon(VECTOR_ELT(hdlCons, cid));
+
+    /* sessions work at the same time only in a threaded environment */
+    if ((con->drv_rodbiCon != drv) || !drv->ctx_rodbiDrv.threaded_roociCtx)
+      RODBI_ERROR(RODBI_ERR_QRYS_THREADED);
+
+    for (i = 0; i < cid; i++)
+      if (rodbiGetCon(VECTOR_ELT(hdlCons, i)) == con)
+        RODBI_ERROR(RODBI_ERR_QRYS_SAME_CON);
+
+    /* same restriction as rociResInit */
+    stmt_cache_size = 0;
+    RODBI_CHECK_CON(con, __func__, 1, FALSE,
+                    roociGetConInfo(&con->con_rodbiCon, NULL, NULL, NULL,
+                                    &stmt_cache_size));
+    if (!pref && !con->ociprefetch_rodbiCon && (stmt_cache_size > 0))
+      RODBI_ERROR(RODBI_ERR_PREF_STMT_CACHE);
+  }
+
+  PROTECT(out = allocVector(VECSXP, LENGTH(statements)));
+
+  ROOCI_MEM_ALLOC(qrys, 1, sizeof(rodbiQrys));
+  if (!qrys)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  qrys->drv_rodbiQrys = drv;
+
+  ROOCI_MEM_ALLOC(qrys->qry_rodbiQrys, ncon, sizeof(rodbiQry));
+  if (!qrys->qry_rodbiQrys)
+  {
+    rodbiQrysFree(qrys, FALSE);
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  }
+
+  qrys->cnt_rodbiQrys    = ncon;
+  qrys->stmt_rodbiQrys   = statements;
+  qrys->out_rodbiQrys    = out;
+  qrys->left_rodbiQrys   = LENGTH(statements);
+  qrys->pref_rodbiQrys   = pref;
+  qrys->nrows_rodbiQrys  = INTEGER(nrows)[0];
+  qrys->nbytes_rodbiQrys = REAL(nbytes)[0];
+  for (cid = 0; cid < ncon; cid++)
+  {
+    qrys->qry_rodbiQrys[cid].all_rodbiQry = qrys;
+    qrys->qry_rodbiQrys[cid].con_rodbiQry =
+                                      rodbiGetCon(VECTOR_ELT(hdlCons, cid));
+  }
+
+  /* workers report that they are done under the mutex */
+  status = OCIThreadMutexInit(drv->ctx_rodbiDrv.env_roociCtx,
+                              drv->ctx_rodbiDrv.lerr_roociCtx,
+                              &qrys->mtx_rodbiQrys);
+  if (status != OCI_SUCCESS)
+  {
+    rodbiQrysFree(qrys, FALSE);
+    RODBI_CHECK_DRV(drv, __func__, __LINE__, FALSE, status);
+  }
+
+  /* running queries are broken and freed however rodbiQrysRun ends */
+  PROTECT(cont = R_MakeUnwindCont());
+  R_UnwindProtect(rodbiQrysRun, (void *)qrys, rodbiQrysFree, (void *)qrys,
+                  cont);
+
+  RODBI_TRACE("queries run");
+
+  UNPROTECT(2);
+  return out;
+} /* end rociConQueries */
+
+/****************************************************************************/
+/*  (*) POOL FUNCTIONS                                                      */
+/****************************************************************************/
+
+/* ------------------------------ rociPoolInit ---------------------------- */
+
+SEXP rociPoolInit(SEXP ptrDrv, SEXP params, SEXP sizes, SEXP stmtCacheSize)
+{
+  char       *user   = (char *)CHAR(STRING_ELT(params, 0));
+  char       *pass   = (char *)CHAR(STRING_ELT(params, 1));
+  char       *conStr = (char *)CHAR(STRING_ELT(params, 2));
+  rodbiDrv   *drv    = rodbiGetDrv(ptrDrv);
+  text       *errMsg =
+          &drv->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  rodbiPool  *pool;
+  SEXP        hdlPool;
+  sword       rc;
+
+  /* allocate rodbi pool */
+  ROOCI_MEM_ALLOC(pool, 1, sizeof(rodbiPool));
+  if (!pool)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+
+  pool->drv_rodbiPool = drv;
+  (pool->pool_rodbiPool).parent_roociPool = pool;
+
+  /* log on the minimum number of sessions */
+  rc = roociInitializePool(&drv->ctx_rodbiDrv, &(pool->pool_rodbiPool),
+                           user, pass, conStr, (ub4)INTEGER(sizes)[0],
+                           (ub4)INTEGER(sizes)[1], (ub4)INTEGER(sizes)[2],
+                           (ub4)INTEGER(stmtCacheSize)[0]);
+  if (rc != OCI_SUCCESS)
+  {
+    sb4  errNum = 0;
+
+    if (rc == ROOCI_DRV_ERR_MEM_FAIL)
+      snprintf((char *)errMsg, ROOCI_ERR_LEN, "%s", RODBI_ERR_MEMORY_ALC);
+    else
+    {
+      *errMsg = 0;
+      roociGetPoolError(&(pool->pool_rodbiPool), &errNum, errMsg,
+                        (ub4)ROOCI_ERR_LEN - 1);
+    }
+    roociTerminatePool(&(pool->pool_rodbiPool));
+    ROOCI_MEM_FREE(pool);
+    RODBI_ERROR(errMsg);
+  }
+
+  /* allocate pool handle */
+  hdlPool = R_MakeExternalPtr((void *)pool, R_NilValue, R_NilValue);
+
+  /* set pool magic word */
+  pool->magicWord_rodbiPool = RODBI_CHECKWD;
+
+  RODBI_TRACE("pool created");
+
+  return hdlPool;
+} /* end rociPoolInit */
+
+/* ------------------------------ rociPoolInfo ---------------------------- */
+
+SEXP rociPoolInfo(SEXP hdlPool)
+{
+  rodbiPool  *pool  = rodbiGetPool(hdlPool);
+  roociPool  *ppool = &(pool->pool_rodbiPool);
+  rodbiDrv   *drv   = pool->drv_rodbiPool;
+  text       *errMsg =
+          &drv->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  SEXP        info;
+  SEXP        names;
+  ub4         open  = 0;
+  ub4         busy  = 0;
+
+  if (roociGetPoolInfo(ppool, &open, &busy) != OCI_SUCCESS)
+  {
+    sb4  errNum = 0;
+
+    *errMsg = 0;
+    roociGetPoolError(ppool, &errNum, errMsg, (ub4)ROOCI_ERR_LEN - 1);
+    RODBI_ERROR(errMsg);
+  }
+
+  /* allocate output list */
+  PROTECT(info = allocVector(VECSXP, 8));
+
+  /* allocate list element names */
+  names = allocVector(STRSXP, 8);
+  setAttrib(info, R_NamesSymbol, names);                  /* protects names */
+
+  /* dbname */
+  SET_VECTOR_ELT(info,  0, mkString(ppool->cstr_roociPool));
+  SET_STRING_ELT(names, 0, mkChar("dbname"));
+
+  /* min */
+  SET_VECTOR_ELT(info,  1, ScalarInteger((int)ppool->min_roociPool));
+  SET_STRING_ELT(names, 1, mkChar("min"));
+
+  /* max */
+  SET_VECTOR_ELT(info,  2, ScalarInteger((int)ppool->max_roociPool));
+  SET_STRING_ELT(names, 2, mkChar("max"));
+
+  /* incr */
+  SET_VECTOR_ELT(info,  3, ScalarInteger((int)ppool->incr_roociPool));
+  SET_STRING_ELT(names, 3, mkChar("incr"));
+
+  /* stmt_cache */
+  SET_VECTOR_ELT(info,  4, ScalarInteger((int)ppool->scache_roociPool));
+  SET_STRING_ELT(names, 4, mkChar("stmt_cache"));
+
+  /* sessOpen */
+  SET_VECTOR_ELT(info,  5, ScalarInteger((int)open));
+  SET_STRING_ELT(names, 5, mkChar("sessOpen"));
+
+  /* sessBusy */
+  SET_VECTOR_ELT(info,  6, ScalarInteger((int)busy));
+  SET_STRING_ELT(names, 6, mkChar("sessBusy"));
+
+  /* conOpen */
+  SET_VECTOR_ELT(info,  7, ScalarInteger(ppool->ncon_roociPool));
+  SET_STRING_ELT(names, 7, mkChar("conOpen"));
+
+  /* release info list */
+  UNPROTECT(1);
+
+  RODBI_TRACE("pool described");
+
+  return info;
+} /* end rociPoolInfo */
+
+/* ------------------------------ rociPoolTerm ---------------------------- */
+
+SEXP rociPoolTerm(SEXP hdlPool)
+{
+  rodbiPool  *pool = rodbiGetPool(hdlPool);
+
+  /* clean up */
+  R_ClearExternalPtr(hdlPool);
+  rodbiPoolTerm(pool);
+
+  RODBI_TRACE("pool removed");
+
+  return R_NilValue;
+} /* end rociPoolTerm */
+
+
+/****************************************************************************/
+/*  (*) RESULT FUNCTIONS                                                    */
+/****************************************************************************/
+
+
+/* ------------------------------ rociResInit ----------------------------- */
+
+SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
+                 SEXP prefetch, SEXP nrows, SEXP nrows_write, SEXP sparse,
+                 SEXP nbytes, SEXP pipeline, SEXP batch_errors)
+{
+  rodbiCon   *con             = rodbiGetCon(hdlCon);
+  rodbiRes   *res;
+  SEXP        hdlRes;
+  boolean     pref;
+  int         rows_per_fetch;
+  int         rows_per_write;
+  cetype_t    enc;                                 /* encoding of statement */
+  ub1         qry_encoding    = CE_NATIVE;
+  ub4         stmt_cache_size = 0;
+  int         bid;
+
+  pref = ((*LOGICAL(prefetch) == TRUE) ? TRUE :
+                                        (con->ociprefetch_rodbiCon ? TRUE : 
+                                                                     FALSE));
+  /* There is some problem with statement cache and prefetch = FALSE optons.
+     Hence blocking this combination for time being. */
+  RODBI_CHECK_CON(con, __func__, 1, FALSE,
+                  roociGetConInfo(&con->con_rodbiCon, NULL, NULL, NULL, 
+                                  &stmt_cache_size));
+
+  if (pref == FALSE && stmt_cache_size > 0)
+    RODBI_ERROR(RODBI_ERR_PREF_STMT_CACHE);
+
+  /* allocate rodbi result */
+  ROOCI_MEM_ALLOC(res, 1, sizeof(rodbiRes));
+  if (!res)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
 
   res->con_rodbiRes = con;
   con->err_checked_rodbiCon = FALSE;
@@ -1814,7 +2746,8 @@ SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
   rows_per_fetch = (INTEGER(nrows)[0] == RODBI_BULK_READ) ?
                                    ((con->nrows_rodbiCon == RODBI_BULK_READ) ? 
                                       RODBI_BULK_READ : con->nrows_rodbiCon) :
-                                                            INTEGER(nrows)[0];
+                   (INTEGER(nrows)[0] == RODBI_BULK_READ_AUTO) ?
+                                      RODBI_BULK_READ : INTEGER(nrows)[0];
 
   rows_per_write = (INTEGER(nrows_write)[0] == RODBI_BULK_WRITE) ?
                                    ((con->nrows_write_rodbiCon == 
@@ -1865,6 +2798,19 @@ SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
                                      rows_per_fetch, rows_per_write));
 
   (res->res_rodbiRes).parent_roociRes = res;
+  /* rows per fetch are sized from the define buffers after describe */
+  if (INTEGER(nrows)[0] == RODBI_BULK_READ_AUTO)
+    res->res_rodbiRes.fbytes_roociRes = REAL(nbytes)[0];
+  /* bind copy of DML overlaps execute in an OCI thread */
+  res->pipe_rodbiRes = (*LOGICAL(pipeline) == TRUE) ? TRUE : FALSE;
+  /* array DML reports the rows in error instead of failing */
+  if ((*LOGICAL(batch_errors) == TRUE) &&
+      ((res->styp_rodbiRes == OCI_STMT_INSERT) ||
+       (res->styp_rodbiRes == OCI_STMT_UPDATE) ||
+       (res->styp_rodbiRes == OCI_STMT_DELETE) ||
+       (res->styp_rodbiRes == OCI_STMT_MERGE)))
+    RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
+                    roociBatchErrInit(&(res->res_rodbiRes)));
   /* vector data in data frame has elements with zeros */
   res->res_rodbiRes.sparse_vec_roociRes = (*LOGICAL(sparse) == TRUE) ? TRUE :
                res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv.bMatrixPkgLoaded;
@@ -1908,6 +2854,9 @@ SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
     /* define data */
     RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
                     roociResDefine(&res->res_rodbiRes));
+
+    /* select accumulation kernels */
+    rodbiResKernel(res);
   }  
 
   /* allocate result handle */
@@ -1920,7 +2869,7 @@ SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
   /* set magic word for result set */
   res->magicWord_rodbiRes   = RODBI_CHECKWD;
   res->ociprefetch_rodbiRes = pref;
-  res->nrows_rodbiRes       = rows_per_fetch;
+  res->nrows_rodbiRes       = res->res_rodbiRes.nrows_roociRes;
   res->nrows_write_rodbiRes = rows_per_write;
 
   RODBI_TRACE("result created");
@@ -1928,47 +2877,192 @@ SEXP rociResInit(SEXP hdlCon, SEXP statement, SEXP data,
   return hdlRes;
 } /* end rociResInit */
 
-/* ------------------------------ rociResExec ----------------------------- */
+/* ------------------------------ rociResAsync ---------------------------- */
 
-SEXP rociResExec(SEXP hdlRes, SEXP data)
+SEXP rociResAsync(SEXP hdlCon, SEXP statement, SEXP prefetch, SEXP nrows,
+                  SEXP nbytes)
 {
-  rodbiRes  *res = rodbiGetRes(hdlRes);
-  rodbiCon  *con = res->con_rodbiRes;
-
-  con->err_checked_rodbiCon = FALSE;
-
-  /* execute the statement */
-  rodbiResExecStmt(res, data, FALSE);
+  rodbiCon   *con             = rodbiGetCon(hdlCon);
+  rodbiDrv   *drv             = con->drv_rodbiCon;
+  SEXP        stmt            = STRING_ELT(statement, 0);
+  cetype_t    enc             = Rf_getCharCE(stmt);
+  rodbiRes   *res;
+  rodbiAsync *async;
+  SEXP        hdlRes;
+  boolean     pref;
+  int         rows_per_fetch;
+  ub1         qry_encoding;
+  ub4         stmt_cache_size = 0;
+  sword       status;
 
-  RODBI_TRACE("result executed");
+  pref = ((*LOGICAL(prefetch) == TRUE) ? TRUE :
+                                        (con->ociprefetch_rodbiCon ? TRUE :
+                                                                     FALSE));
 
-  return R_NilValue;
-} /* end rociResExec */
+  /* same restriction as rociResInit */
+  RODBI_CHECK_CON(con, __func__, 1, FALSE,
+                  roociGetConInfo(&con->con_rodbiCon, NULL, NULL, NULL,
+                                  &stmt_cache_size));
 
-/* ----------------------------- rociResFetch ----------------------------- */
+  if (pref == FALSE && stmt_cache_size > 0)
+    RODBI_ERROR(RODBI_ERR_PREF_STMT_CACHE);
 
-SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
-{
-  rodbiRes    *res       = rodbiGetRes(hdlRes);
-  rodbiCon    *con       = res->con_rodbiRes;
-  int          nrow      = INTEGER(numRec)[0];
-  boolean      hasOutput = FALSE;
-  ub4          fch_rows  = 0;
+  rows_per_fetch = (INTEGER(nrows)[0] == RODBI_BULK_READ) ?
+                                   ((con->nrows_rodbiCon == RODBI_BULK_READ) ?
+                                      RODBI_BULK_READ : con->nrows_rodbiCon) :
+                   (INTEGER(nrows)[0] == RODBI_BULK_READ_AUTO) ?
+                                      RODBI_BULK_READ : INTEGER(nrows)[0];
 
-  /* use this flag to communicate between successive rodbiPlsqlResPopulate() */
-  ub4          flag      = 1;
+  qry_encoding = (enc == CE_UTF8)   ? ROOCI_QRY_UTF8   :
+                 (enc == CE_LATIN1) ? ROOCI_QRY_LATIN1 : ROOCI_QRY_NATIVE;
 
-  /* Create new result set for PLSQL OUT or IN OUT case */
-  if (res->numOut)
-    rodbiPlsqlResPopulate(res, &flag);
+  /* allocate rodbi result */
+  ROOCI_MEM_ALLOC(res, 1, sizeof(rodbiRes));
+  if (!res)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
 
+  res->con_rodbiRes         = con;
+  res->cnvtxt_rodbiRes      = ((enc == CE_UTF8) || (enc == CE_LATIN1)) ?
+                                                                TRUE : FALSE;
   con->err_checked_rodbiCon = FALSE;
 
-  /* setup adaptive fetching */
-  if (nrow <= 0)
+  if (con->con_rodbiCon.timesten_rociCon)
   {
-    nrow                 = res->nrows_rodbiRes;
-    res->expand_rodbiRes = TRUE;
+    /* execute optimizer statements for TimesTen connections */
+    status = roociExecTTOpt(&(con->con_rodbiCon));
+    RODBI_CHECK_RES(res, __func__, __LINE__, TRUE, status);
+  }
+
+  /* Initialize result set */
+  RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
+                  roociInitializeRes(&(con->con_rodbiCon),
+                                     &(res->res_rodbiRes),
+                                     (oratext *)CHAR(stmt), LENGTH(stmt),
+                                     qry_encoding, &(res->styp_rodbiRes),
+                                     pref, rows_per_fetch, RODBI_BULK_WRITE));
+
+  (res->res_rodbiRes).parent_roociRes = res;
+  /* rows per fetch are sized from the define buffers after describe */
+  if (INTEGER(nrows)[0] == RODBI_BULK_READ_AUTO)
+    res->res_rodbiRes.fbytes_roociRes = REAL(nbytes)[0];
+  res->res_rodbiRes.sparse_vec_roociRes = drv->ctx_rodbiDrv.bMatrixPkgLoaded;
+
+  /* bump up the number open/total results */
+  (con->con_rodbiCon).num_roociCon++;
+  (con->con_rodbiCon).tot_roociCon++;
+
+  res->magicWord_rodbiRes   = RODBI_CHECKWD;
+  res->ociprefetch_rodbiRes = pref;
+  res->nrows_rodbiRes       = rows_per_fetch;
+  res->nrows_write_rodbiRes = RODBI_BULK_WRITE;
+
+  /* from here on the result is freed by rodbiResTerm */
+  if ((res->res_rodbiRes).bcnt_roociRes)
+  {
+    rodbiResTerm(res);
+    RODBI_ERROR(RODBI_ERR_ASYNC_BINDS);
+  }
+
+  ROOCI_MEM_ALLOC(async, 1, sizeof(rodbiAsync));
+  if (!async)
+  {
+    rodbiResTerm(res);
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  }
+  res->async_rodbiRes = async;
+
+  /* the worker reports that it is done under the mutex */
+  if (drv->ctx_rodbiDrv.threaded_roociCtx)
+  {
+    status = OCIThreadMutexInit(drv->ctx_rodbiDrv.env_roociCtx,
+                                drv->ctx_rodbiDrv.lerr_roociCtx,
+                                &async->mtx_rodbiAsync);
+    if (status != OCI_SUCCESS)
+    {
+      rodbiResTerm(res);
+      RODBI_CHECK_DRV(drv, __func__, __LINE__, FALSE, status);
+    }
+  }
+
+  /* the worker reports its errors on its own handle, the connection's is
+     left to the break of rociResCancel */
+  status = OCIHandleAlloc(drv->ctx_rodbiDrv.env_roociCtx,
+                          (void **)&async->err_rodbiAsync, OCI_HTYPE_ERROR,
+                          (size_t)0, (void **)NULL);
+  if (status != OCI_SUCCESS)
+  {
+    rodbiResTerm(res);
+    RODBI_CHECK_DRV(drv, __func__, __LINE__, FALSE, status);
+  }
+  async->con_rodbiAsync              = con->con_rodbiCon;
+  async->con_rodbiAsync.err_roociCon = async->err_rodbiAsync;
+  (res->res_rodbiRes).con_roociRes   = &async->con_rodbiAsync;
+
+  /* allocate result handle */
+  hdlRes = R_MakeExternalPtr((void *)res, R_NilValue, R_NilValue);
+
+  /* other sessions may be used while it runs only in a threaded
+     environment, without one or a thread the statement runs here */
+  if (!async->mtx_rodbiAsync ||
+      (roociThrCreate(&(con->con_rodbiCon), rodbiResAsyncWork, (void *)res,
+                      &async->tid_rodbiAsync, &async->thd_rodbiAsync) !=
+                                                                OCI_SUCCESS))
+    rodbiResAsyncWork((void *)res);
+
+  RODBI_TRACE("result started");
+
+  return hdlRes;
+} /* end rociResAsync */
+
+/* ------------------------------ rociResExec ----------------------------- */
+
+SEXP rociResExec(SEXP hdlRes, SEXP data)
+{
+  rodbiRes  *res = rodbiGetRes(hdlRes);
+  rodbiCon  *con = res->con_rodbiRes;
+
+  rodbiResAsyncWait(res, FALSE);
+
+  con->err_checked_rodbiCon = FALSE;
+
+  /* execute the statement */
+  rodbiResExecStmt(res, data, FALSE);
+
+  RODBI_TRACE("result executed");
+
+  return R_NilValue;
+} /* end rociResExec */
+
+/* ----------------------------- rociResFetch ----------------------------- */
+
+SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
+{
+  rodbiRes    *res       = rodbiGetRes(hdlRes);
+  rodbiCon    *con       = res->con_rodbiRes;
+  int          nrow      = INTEGER(numRec)[0];
+  boolean      hasOutput = FALSE;
+  ub4          fch_rows  = 0;
+
+  /* use this flag to communicate between successive rodbiPlsqlResPopulate() */
+  ub4          flag      = 1;
+
+  /* rows of an asynchronous statement are fetched once it is executed */
+  rodbiResAsyncWait(res, FALSE);
+
+  /* Create new result set for PLSQL OUT or IN OUT case */
+  if (res->numOut)
+    rodbiPlsqlResPopulate(res, &flag);
+
+  /* CHARSXPs cached by a previous fetch may no longer be referenced */
+  rodbiSCacheReset(res);
+
+  con->err_checked_rodbiCon = FALSE;
+
+  /* setup adaptive fetching */
+  if (nrow <= 0)
+  {
+    nrow                 = res->nrows_rodbiRes;
+    res->expand_rodbiRes = TRUE;
   }
   else
     /* Do not cache results as user is explicitly fetching n rows at a time */
@@ -1991,17 +3085,30 @@ SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
         res->state_rodbiRes = OUTPUT_rodbiState;
         break;
       }
-      /* fetch data */
-      RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-                      roociFetchData(&(res->res_rodbiRes), &fch_rows, 
-                                     &(res->done_rodbiRes)));
+      if (res->res_rodbiRes.pipe_roociRes)
+      {
+        /* take the batch fetched while the previous one was converted */
+        RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                        roociPipeFetch(&(res->res_rodbiRes), &fch_rows,
+                                       &(res->done_rodbiRes)));
+      }
+      else
+      {
+        /* fetch fixed width columns in place when output vectors have room */
+        rodbiResDirect(res);
+
+        /* fetch data */
+        RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                        roociFetchData(&(res->res_rodbiRes), &fch_rows, 
+                                       &(res->done_rodbiRes)));
+      }
      res->fchNum_rodbiRes = (int)fch_rows;
      /* set state */
      res->fchBeg_rodbiRes = 0;
      /* if there are more than nrows_roociRes, cache result set in ROracle */
      if (res->done_rodbiRes)
      {
-       if (res->pghdl_rodbiRes)
+       if (res->arena_rodbiRes)
          res->nrow_rodbiRes += fch_rows;
        else
        {
@@ -2018,11 +3125,11 @@ SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
         * cache results only when BLOB,CLOB, BFILE or user-defined types
         * not in result set
        */
-       if (!res->res_rodbiRes.nocache_roociRes && !res->pghdl_rodbiRes)
+       if (!res->res_rodbiRes.nocache_roociRes && !res->arena_rodbiRes)
        {
-         ROOCI_MEM_ALLOC(res->pghdl_rodbiRes, res->res_rodbiRes.ncol_roociRes,
-                         sizeof(rodbichdl));
-         if (!res->pghdl_rodbiRes)
+         ROOCI_MEM_ALLOC(res->arena_rodbiRes, res->res_rodbiRes.ncol_roociRes,
+                         sizeof(rodbiArena));
+         if (!res->arena_rodbiRes)
            RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
          res->nrow_rodbiRes += fch_rows;
        }
@@ -2035,7 +3142,7 @@ SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
       break;
 
     case ACCUM_rodbiState:
-      if (res->pghdl_rodbiRes)
+      if (res->arena_rodbiRes)
         rodbiResAccumInCache(res);
       else
         rodbiResAccum(res);
@@ -2078,6 +3185,9 @@ SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
     rodbiResStateNext(res);
   }
 
+  /* no fetch may run on the connection once control returns to R */
+  roociPipeWait(&(res->res_rodbiRes), FALSE);
+
   RODBI_TRACE("result fetched");
 
   /* release output data frame and column names vector */
@@ -2102,6 +3212,96 @@ SEXP rociResFetch(SEXP hdlRes, SEXP numRec)
 
 } /* end rociResFetch */
 
+/* ----------------------------- rociResFactors --------------------------- */
+
+SEXP rociResFactors(SEXP hdlRes, SEXP factors)
+{
+  rodbiRes    *res  = rodbiGetRes(hdlRes);
+  int          ncol;
+  int          cid;
+
+  rodbiResAsyncWait(res, FALSE);
+
+  ncol = res->res_rodbiRes.ncol_roociRes;
+  if (!res->kern_rodbiRes)
+    return R_NilValue;
+
+  if (!res->dict_rodbiRes)
+  {
+    ROOCI_MEM_ALLOC(res->dict_rodbiRes, (ncol ? ncol : 1), sizeof(rodbiDict));
+    if (!res->dict_rodbiRes)
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  }
+
+  /* only columns fetched as character strings can become factors */
+  for (cid = 0; (cid < ncol) && (cid < LENGTH(factors)); cid++)
+  {
+    boolean fac = (LOGICAL(factors)[cid] == TRUE);
+
+    switch (res->kern_rodbiRes[cid])
+    {
+    case STR_rodbiKern:
+    case FAC_rodbiKern:
+      res->kern_rodbiRes[cid] = fac ? FAC_rodbiKern : STR_rodbiKern;
+      break;
+
+    case UCS_rodbiKern:
+    case FUC_rodbiKern:
+      res->kern_rodbiRes[cid] = fac ? FUC_rodbiKern : UCS_rodbiKern;
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  return R_NilValue;
+} /* end rociResFactors */
+
+/* ---------------------------- rociResPipeline --------------------------- */
+
+SEXP rociResPipeline(SEXP hdlRes, SEXP pipeline)
+{
+  rodbiRes    *res  = rodbiGetRes(hdlRes);
+  roociRes    *pres = &(res->res_rodbiRes);
+  int          cid;
+
+  rodbiResAsyncWait(res, FALSE);
+
+  if (pres->pipe_roociRes)
+    return ScalarLogical(TRUE);
+
+  /* PL/SQL output and prefetch only results fetch through OCI as before,
+     so do all results without a threaded environment: an R error during
+     conversion leaves the fetch running while another connection calls OCI */
+  if ((LOGICAL(pipeline)[0] != TRUE) || !res->kern_rodbiRes || res->numOut ||
+      pres->prefetch_roociRes ||
+      !res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv.threaded_roociCtx)
+    return ScalarLogical(FALSE);
+
+  /* conversion must not call OCI while the next batch is being fetched */
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    switch (res->kern_rodbiRes[cid])
+    {
+    case INT_rodbiKern:
+    case FLT_rodbiKern:
+    case STR_rodbiKern:
+    case BIN_rodbiKern:
+    case DTN_rodbiKern:
+    case FAC_rodbiKern:
+      break;
+
+    default:
+      return ScalarLogical(FALSE);
+    }
+  }
+
+  RODBI_CHECK_RES(res, __func__, __LINE__, FALSE, roociPipeInit(pres));
+
+  return ScalarLogical(TRUE);
+} /* end rociResPipeline */
+
 /* ------------------------------ rociResInfo ----------------------------- */
 
 SEXP rociResInfo(SEXP hdlRes)
@@ -2113,11 +3313,13 @@ SEXP rociResInfo(SEXP hdlRes)
 
   con->err_checked_rodbiCon = FALSE;
 
+  rodbiResAsyncWait(res, FALSE);
+
   /* allocate output list */
-  PROTECT(info = allocVector(VECSXP, 9));
+  PROTECT(info = allocVector(VECSXP, 11));
 
   /* allocate list element names */
-  names = allocVector(STRSXP, 9);
+  names = allocVector(STRSXP, 11);
   setAttrib(info, R_NamesSymbol, names);                  /* protects names */
 
   /* statement */
@@ -2160,6 +3362,28 @@ SEXP rociResInfo(SEXP hdlRes)
   SET_VECTOR_ELT(info,  8, rodbiResInfoFields(res));
   SET_STRING_ELT(names, 8, mkChar("fields"));
 
+  /* stringCacheHitRate */
+  if (res->scache_rodbiRes)
+  {
+    int     cid;
+    double  lkp = 0;
+    double  hit = 0;
+
+    for (cid = 0; cid < res->res_rodbiRes.ncol_roociRes; cid++)
+    {
+      lkp += res->scache_rodbiRes[cid].lkp_rodbiSCache;
+      hit += res->scache_rodbiRes[cid].hit_rodbiSCache;
+    }
+    SET_VECTOR_ELT(info,  9, ScalarReal(lkp ? (hit / lkp) : NA_REAL));
+  }
+  else
+    SET_VECTOR_ELT(info,  9, ScalarReal(NA_REAL));
+  SET_STRING_ELT(names, 9, mkChar("stringCacheHitRate"));
+
+  /* batchErrors */
+  SET_VECTOR_ELT(info, 10, rodbiResInfoBatch(res));
+  SET_STRING_ELT(names, 10, mkChar("batchErrors"));
+
   /* release info list */
   UNPROTECT(1);
 
@@ -2175,6 +3399,8 @@ SEXP rociEOFRes(SEXP hdlRes)
   rodbiRes    *res = rodbiGetRes(hdlRes);
   SEXP         ret;
 
+  rodbiResAsyncWait(res, FALSE);
+
   PROTECT(ret = NEW_LOGICAL(1));
 
   if (res->state_rodbiRes == CLOSE_rodbiState)
@@ -2186,11 +3412,55 @@ SEXP rociEOFRes(SEXP hdlRes)
   return ret;
 } /* end rociEOFRes */
 
+/* ------------------------------ rociResReady ---------------------------- */
+
+SEXP rociResReady(SEXP hdlRes)
+{
+  rodbiRes    *res = rodbiGetResAsync(hdlRes);
+
+  return ScalarLogical(rodbiResAsyncDone(res));
+} /* end rociResReady */
+
+/* ------------------------------ rociResAwait ---------------------------- */
+
+SEXP rociResAwait(SEXP hdlRes, SEXP timeout)
+{
+  rodbiRes    *res   = rodbiGetResAsync(hdlRes);
+  double       wait  = REAL(timeout)[0] * 1000;
+  double       start = roociClock();
+
+  /* an interrupt only stops waiting, the statement keeps running */
+  while (!rodbiResAsyncDone(res))
+  {
+    if (R_FINITE(wait) && ((roociClock() - start) >= wait))
+      return ScalarLogical(FALSE);
+
+    R_CheckUserInterrupt();
+    roociSleep(1);
+  }
+
+  return ScalarLogical(TRUE);
+} /* end rociResAwait */
+
+/* ----------------------------- rociResCancel ---------------------------- */
+
+SEXP rociResCancel(SEXP hdlRes)
+{
+  rodbiRes    *res  = rodbiGetResAsync(hdlRes);
+  boolean      done = rodbiResAsyncDone(res);
+
+  rodbiResAsyncWait(res, TRUE);
+
+  RODBI_TRACE("result cancelled");
+
+  return ScalarLogical(done ? FALSE : TRUE);
+} /* end rociResCancel */
+
 /* ------------------------------- rociResTerm ---------------------------- */
 
 SEXP rociResTerm(SEXP hdlRes)
 {
-  rodbiRes  *res = rodbiGetRes(hdlRes);
+  rodbiRes  *res = rodbiGetResAsync(hdlRes);
   rodbiCon  *con;
 
   if (res)
@@ -2290,6 +3560,10 @@ static void rodbiDrvFree(rodbiDrv *drv)
     con = roociGetNextParentCon(&(drv->ctx_rodbiDrv));
   }
 
+  /* destroy session pools, their connections are closed */
+  while (drv->ctx_rodbiDrv.pool_roociCtx)
+    rodbiPoolTerm(drv->ctx_rodbiDrv.pool_roociCtx->parent_roociPool);
+
   /* free driver oci context */
   RODBI_CHECK_DRV(drv, __func__, 1, FALSE,
                   roociTerminateCtx(&(drv->ctx_rodbiDrv)));
@@ -2349,108 +3623,683 @@ static rodbiCon *rodbiGetCon(SEXP hdlCon)
   if (!con || (con && !rodbiAssertCon(con, __func__, 1)))
     RODBI_ERROR(RODBI_ERR_INVALID_CON);
 
+  rodbiConWait(con, FALSE);
+
   return con;
 } /* rodbiGetCon */
 
 
-/* -------------------------- rodbiConInfoResults ------------------------- */
+/* ------------------------------ rodbiConWait ---------------------------- */
 
-static SEXP rodbiConInfoResults(SEXP conxp)
+static void rodbiConWait(rodbiCon *con, boolean cancel)
 {
-  rodbiCon   *con  = rodbiGetCon(conxp);
-  SEXP        list  = R_NilValue;
-  int         resID;
-  int         lstID = 0;
-  int         activeRes = (con->con_rodbiCon).num_roociCon;
+  roociRes  *pres;
+  int        resID;
 
-  if (activeRes)
+  for (resID = 0; resID < con->con_rodbiCon.max_roociCon; resID++)
   {
-    /* allocate output list */
-    PROTECT(list = allocVector(VECSXP, activeRes));
-
-    /* set valid result IDs */ 
-    for (resID = 0; resID < (con->con_rodbiCon).max_roociCon; resID++)
-    {
-      roociRes *res = (con->con_rodbiCon).res_roociCon[resID];
-      if (res && rodbiAssertRes(res->parent_roociRes, __func__, 1))
-      {
-        /* allocate result handle */
-        SEXP hdlRes = R_MakeExternalPtr(res->parent_roociRes,
-                                        R_NilValue, R_NilValue);
-        SET_VECTOR_ELT(list, lstID++, hdlRes);              /* protects vec */
-      }
-    }
-
-    /* release output list */
-    UNPROTECT(1);
+    if (!(pres = con->con_rodbiCon.res_roociCon[resID]))
+      continue;
+
+    /* an asynchronous statement has the session to itself until it is
+       done, its error is reported on its own result */
+    if (pres->parent_roociRes &&
+        ((rodbiRes *)pres->parent_roociRes)->async_rodbiRes)
+      rodbiResAsyncJoin((rodbiRes *)pres->parent_roociRes, cancel);
+
+    /* an error during conversion may have left a background fetch or
+       execute running */
+    roociPipeWait(pres, FALSE);
   }
 
-  return list;
-} /* end rodbiConInfoResults */
+  /* or the worker sessions of a parallel write */
+  if (con->par_rodbiCon)
+    rodbiConParFree(con);
+} /* end rodbiConWait */
 
+/* ---------------------------- rodbiConLoadFail -------------------------- */
 
-/* ----------------------------- rodbiConTerm ----------------------------- */
-  
-static void rodbiConTerm(rodbiCon *con)
-{ 
-  rodbiRes  *res;
+static void rodbiConLoadFail(rodbiCon *con, roociDirPath *pdp, sword status,
+                             int beg, int end)
+{
+  text   *errMsg =
+    &(con)->drv_rodbiCon->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  size_t  len;
 
-  /* Free all results */
-  res = roociGetFirstParentRes(&(con->con_rodbiCon));
-  while(res)
-  {
-    if (!rodbiAssertRes(res, __func__, 1))
-      RODBI_ERROR(RODBI_ERR_INVALID_RES);
-    rodbiResTerm(res);
-    res = roociGetNextParentRes(&(con->con_rodbiCon));
-  }
+  /* message first, the abort resets the error handle */
+  rodbiCheck(con->drv_rodbiCon, con, __func__, __LINE__, status, errMsg,
+             ROOCI_ERR_LEN);
+  roociDirPathFree(&(con->con_rodbiCon), pdp, TRUE);
 
-  /* free connection */
-  RODBI_CHECK_CON(con, __func__, 1, FALSE,
-                  roociTerminateCon(&(con->con_rodbiCon), 1));
+  len = strlen((const char *)errMsg);
+  if (end && (len < ROOCI_ERR_LEN))
+    snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len, RODBI_ERR_LOAD_ROWS,
+             beg + 1, end);
 
-  ROOCI_MEM_FREE(con);
-} /* end rodbiConTerm */
+  RODBI_ERROR(errMsg);
+} /* end rodbiConLoadFail */
 
+/* ---------------------------- rodbiConParWait --------------------------- */
 
+static void rodbiConParWait(rodbiCon *con, int wid, int nrow)
+{
+  rodbiPar  *par = con->par_rodbiCon;
+  sword      rc  = roociThrExecWait(&par->thr_rodbiPar[wid]);
+  int        beg = par->beg_rodbiPar[wid];
+  int        end = beg + con->nrows_write_rodbiCon;
 
-/****************************************************************************/
-/*  (*) STATEMENT FUNCTIONS                                                 */
-/****************************************************************************/
+  if (rc != OCI_SUCCESS)
+    rodbiConParFail(con, wid, rc, beg, (end > nrow) ? nrow : end);
+} /* end rodbiConParWait */
 
-/* ------------------------------ rodbiGetRes ----------------------------- */
+/* ---------------------------- rodbiConParPlain -------------------------- */
 
-static rodbiRes *rodbiGetRes(SEXP hdlRes)
+static boolean rodbiConParPlain(rodbiCon *con, SEXP statement, SEXP data,
+                                ub1 qry_encoding)
 {
-  rodbiRes *res = R_ExternalPtrAddr(hdlRes);
-  
-  /* check validity */
-  if (!res || (res && !rodbiAssertRes(res, __func__, 1)))
-    RODBI_ERROR(RODBI_ERR_INVALID_RES);
+  rodbiRes  *res;
+  boolean    plain;
 
-  return res;
-} /* rodbiGetRes */
+  /* binds are set up as a worker does, the statement is not executed */
+  ROOCI_MEM_ALLOC(res, 1, sizeof(rodbiRes));
+  if (!res)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  res->con_rodbiRes = con;
 
+  RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
+                  roociInitializeRes(&(con->con_rodbiCon),
+                                     &(res->res_rodbiRes),
+                                     (oratext *)CHAR(STRING_ELT(statement, 0)),
+                                     LENGTH(STRING_ELT(statement, 0)),
+                                     qry_encoding, &(res->styp_rodbiRes),
+                                     TRUE, 1, con->nrows_write_rodbiCon));
+  (res->res_rodbiRes).parent_roociRes = res;
 
-/* ---------------------------- rodbiResExecStmt -------------------------- */
+  rodbiResBind(res, data, con->nrows_write_rodbiCon, TRUE);
+  rodbiResBindDate(res, data, TRUE);
+  plain = rodbiResBindPlain(res);
 
-static void rodbiResExecStmt(rodbiRes *res, SEXP data, boolean free_res)
+  roociResFree(&(res->res_rodbiRes));
+  ROOCI_MEM_FREE(res);
+
+  return plain;
+} /* end rodbiConParPlain */
+
+/* ---------------------------- rodbiConParFail --------------------------- */
+
+static void rodbiConParFail(rodbiCon *con, int wid, sword status, int beg,
+                            int end)
 {
-  switch (res->styp_rodbiRes)
+  rodbiPar  *par    = con->par_rodbiCon;
+  text      *errMsg =
+    &(con)->drv_rodbiCon->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  sb4        errNum = 0;
+  size_t     len;
+
+  /* error of the worker session, rodbiCheck would free a failed session */
+  if ((status == OCI_ERROR) || (status == OCI_SUCCESS_WITH_INFO) ||
+      (status == ROOCI_DRV_ERR_CON_FAIL))
   {
-  case OCI_STMT_SELECT:
-    rodbiResExecQuery(res, data, free_res);
-    break;
-  default:
-    if ((res->res_rodbiRes).bcnt_roociRes)
-      rodbiResExecBind(res, data, free_res);
-    else
-    {
-      /* execute statement */
-       RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+    errMsg[0] = '\0';
+    roociGetError(&par->ctx_rodbiPar,
+                  (wid >= 0) ? &(par->con_rodbiPar[wid].con_rodbiCon) : NULL,
+                  __func__, &errNum, errMsg, (ub4)ROOCI_ERR_LEN - 1);
+  }
+  else
+    rodbiCheck(con->drv_rodbiCon, NULL, __func__, __LINE__, status, errMsg,
+               ROOCI_ERR_LEN);
+
+  len = strlen((const char *)errMsg);
+  if (end && (len < ROOCI_ERR_LEN))
+    snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len, RODBI_ERR_PAR_ROWS,
+             beg + 1, end, wid + 1, par->cnt_rodbiPar);
+  else if ((par->cmt_rodbiPar > 0) && (len < ROOCI_ERR_LEN))
+    snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len, RODBI_ERR_PAR_COMMIT,
+             wid + 1, par->cnt_rodbiPar,
+             par->end_rodbiPar[par->cmt_rodbiPar - 1]);
+  else if (!par->cmt_rodbiPar && (len < ROOCI_ERR_LEN))
+    snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len,
+             RODBI_ERR_PAR_NO_COMMIT, par->cnt_rodbiPar);
+
+  /* sessions not yet committed roll back their rows */
+  rodbiConParFree(con);
+  RODBI_ERROR(errMsg);
+} /* end rodbiConParFail */
+
+/* ---------------------------- rodbiConParFree --------------------------- */
+
+static void rodbiConParFree(rodbiCon *con)
+{
+  rodbiPar  *par = con->par_rodbiCon;
+  int        wid;
+
+  if (!par)
+    return;
+  con->par_rodbiCon = NULL;
+
+  /* no worker may still execute when sessions go away */
+  if (par->thr_rodbiPar)
+    for (wid = 0; wid < par->cnt_rodbiPar; wid++)
+      roociThrExecWait(&par->thr_rodbiPar[wid]);
+
+  /* a session ends with a commit, roll back what was not committed */
+  if (par->con_rodbiPar)
+    for (wid = 0; wid < par->cnt_rodbiPar; wid++)
+      if (par->con_rodbiPar[wid].con_rodbiCon.svc_roociCon)
+        roociRollbackCon(&(par->con_rodbiPar[wid].con_rodbiCon));
+
+  /* sessions, statements and binds go with the context */
+  if (par->ctx_rodbiPar.env_roociCtx)
+    roociTerminateCtx(&par->ctx_rodbiPar);
+
+  if (par->con_rodbiPar)
+    ROOCI_MEM_FREE(par->con_rodbiPar);
+  if (par->res_rodbiPar)
+    ROOCI_MEM_FREE(par->res_rodbiPar);
+  if (par->thr_rodbiPar)
+    ROOCI_MEM_FREE(par->thr_rodbiPar);
+  if (par->rows_rodbiPar)
+    ROOCI_MEM_FREE(par->rows_rodbiPar);
+  if (par->beg_rodbiPar)
+    ROOCI_MEM_FREE(par->beg_rodbiPar);
+  if (par->end_rodbiPar)
+    ROOCI_MEM_FREE(par->end_rodbiPar);
+  ROOCI_MEM_FREE(par);
+} /* end rodbiConParFree */
+
+/* ----------------------------- rodbiQrysStart --------------------------- */
+
+static void rodbiQrysStart(rodbiQry *qry, int qid)
+{
+  rodbiQrys  *qrys = qry->all_rodbiQry;
+  rodbiCon   *con  = qry->con_rodbiQry;
+  SEXP        stmt = STRING_ELT(qrys->stmt_rodbiQrys, qid);
+  cetype_t    enc  = Rf_getCharCE(stmt);
+  rodbiRes   *res;
+  boolean     pref;
+  int         rows_per_fetch;
+  ub1         qry_encoding;
+
+  pref = qrys->pref_rodbiQrys ? TRUE :
+                                (con->ociprefetch_rodbiCon ? TRUE : FALSE);
+
+  rows_per_fetch = (qrys->nrows_rodbiQrys == RODBI_BULK_READ) ?
+                                                       con->nrows_rodbiCon :
+                   (qrys->nrows_rodbiQrys == RODBI_BULK_READ_AUTO) ?
+                                     RODBI_BULK_READ : qrys->nrows_rodbiQrys;
+
+  qry_encoding = (enc == CE_UTF8)   ? ROOCI_QRY_UTF8   :
+                 (enc == CE_LATIN1) ? ROOCI_QRY_LATIN1 : ROOCI_QRY_NATIVE;
+
+  /* allocate rodbi result */
+  ROOCI_MEM_ALLOC(res, 1, sizeof(rodbiRes));
+  if (!res)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+
+  res->con_rodbiRes         = con;
+  res->cnvtxt_rodbiRes      = ((enc == CE_UTF8) || (enc == CE_LATIN1)) ?
+                                                                TRUE : FALSE;
+  con->err_checked_rodbiCon = FALSE;
+
+  if (con->con_rodbiCon.timesten_rociCon)
+  {
+    /* execute optimizer statements for TimesTen connections */
+    sword status = roociExecTTOpt(&(con->con_rodbiCon));
+    RODBI_CHECK_RES(res, __func__, __LINE__, TRUE, status);
+  }
+
+  /* Initialize result set */
+  RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
+                  roociInitializeRes(&(con->con_rodbiCon),
+                                     &(res->res_rodbiRes),
+                                     (oratext *)CHAR(stmt), LENGTH(stmt),
+                                     qry_encoding, &(res->styp_rodbiRes),
+                                     pref, rows_per_fetch, RODBI_BULK_WRITE));
+
+  (res->res_rodbiRes).parent_roociRes = res;
+  /* rows per fetch are sized from the define buffers after describe */
+  if (qrys->nrows_rodbiQrys == RODBI_BULK_READ_AUTO)
+    res->res_rodbiRes.fbytes_roociRes = qrys->nbytes_rodbiQrys;
+  res->res_rodbiRes.sparse_vec_roociRes =
+                           con->drv_rodbiCon->ctx_rodbiDrv.bMatrixPkgLoaded;
+
+  /* bump up the number open/total results */
+  (con->con_rodbiCon).num_roociCon++;
+  (con->con_rodbiCon).tot_roociCon++;
+
+  res->magicWord_rodbiRes   = RODBI_CHECKWD;
+  res->ociprefetch_rodbiRes = pref;
+  res->nrows_write_rodbiRes = RODBI_BULK_WRITE;
+  res->state_rodbiRes       = FETCH_rodbiState;
+
+  /* from here on the result is freed by rodbiQrysFree */
+  qry->res_rodbiQry   = res;
+  qry->qid_rodbiQry   = qid;
+  qry->rc_rodbiQry    = OCI_SUCCESS;
+  qry->arena_rodbiQry = FALSE;
+  qry->done_rodbiQry  = FALSE;
+
+  if (res->styp_rodbiRes != OCI_STMT_SELECT)
+    Rf_error(RODBI_ERR_QRYS_NOT_QUERY, qid + 1);
+
+  /* without a thread the query runs here */
+  if (roociThrCreate(&(con->con_rodbiCon), rodbiQrysWork, (void *)qry,
+                     &qry->tid_rodbiQry, &qry->thd_rodbiQry) != OCI_SUCCESS)
+    rodbiQrysWork((void *)qry);
+} /* end rodbiQrysStart */
+
+/* ----------------------------- rodbiQrysWork ---------------------------- */
+
+static void rodbiQrysWork(void *ctx)
+{
+  rodbiQry   *qry  = (rodbiQry *)ctx;
+  rodbiQrys  *qrys = qry->all_rodbiQry;
+  roociCtx   *pctx = &(qrys->drv_rodbiQrys->ctx_rodbiDrv);
+  rodbiRes   *res  = qry->res_rodbiQry;
+  roociRes   *pres = &(res->res_rodbiRes);
+  sword       rc;
+  int         cid;
+
+  /* execute and define as rociResInit, on the session of this query */
+  rc = roociStmtRun(pres, 0, res->styp_rodbiRes, &(res->affrows_rodbiRes));
+  if (rc == OCI_SUCCESS)
+    rc = roociResDefine(pres);
+  if (rc == OCI_SUCCESS)
+  {
+    res->nrows_rodbiRes = pres->nrows_roociRes;
+    rc = rodbiResKernelSel(res);
+  }
+
+  /* rows of columns that all have a kernel are fetched here */
+  if ((rc == OCI_SUCCESS) && !pres->nocache_roociRes)
+  {
+    for (cid = 0; cid < pres->ncol_roociRes; cid++)
+      if (res->kern_rodbiRes[cid] == GEN_rodbiKern)
+        break;
+
+    if (cid == pres->ncol_roociRes)
+    {
+      qry->arena_rodbiQry = TRUE;
+      rc = rodbiQrysFetch(res);
+    }
+  }
+
+  ROOCI_MUTEX_ACQUIRE(pctx, qrys->mtx_rodbiQrys);
+  qry->rc_rodbiQry   = rc;
+  qry->done_rodbiQry = TRUE;
+  ROOCI_MUTEX_RELEASE(pctx, qrys->mtx_rodbiQrys);
+} /* end rodbiQrysWork */
+
+/* ----------------------------- rodbiQrysFetch --------------------------- */
+
+static sword rodbiQrysFetch(rodbiRes *res)
+{
+  roociRes   *pres     = &(res->res_rodbiRes);
+  ub4         fch_rows = 0;
+  sword       rc;
+  int         cid;
+
+  ROOCI_MEM_ALLOC(res->arena_rodbiRes,
+                  (pres->ncol_roociRes ? pres->ncol_roociRes : 1),
+                  sizeof(rodbiArena));
+  if (!res->arena_rodbiRes)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+
+  /* each batch is added to the arenas as rodbiResAccumInCache does */
+  while (!res->done_rodbiRes)
+  {
+    rc = roociFetchData(pres, &fch_rows, &(res->done_rodbiRes));
+    if (rc != OCI_SUCCESS)
+      return rc;
+
+    res->fchNum_rodbiRes = (int)fch_rows;
+    res->fchBeg_rodbiRes = 0;
+    res->fchEnd_rodbiRes = (int)fch_rows;
+
+    for (cid = 0; cid < pres->ncol_roociRes; cid++)
+    {
+      rc = rodbiResAccumInCacheKernel(res, cid, &res->arena_rodbiRes[cid]);
+      if (rc != OCI_SUCCESS)
+        return rc;
+      if (RODBI_ARENA_NOMEM(&res->arena_rodbiRes[cid]))
+        return ROOCI_DRV_ERR_MEM_FAIL;
+    }
+
+    res->rows_rodbiRes  += (int)fch_rows;
+    res->fchBeg_rodbiRes = res->fchEnd_rodbiRes;
+  }
+
+  res->nrow_rodbiRes = res->rows_rodbiRes;
+
+  return OCI_SUCCESS;
+} /* end rodbiQrysFetch */
+
+/* ------------------------------ rodbiQrysRun ---------------------------- */
+
+static SEXP rodbiQrysRun(void *ctx)
+{
+  rodbiQrys  *qrys = (rodbiQrys *)ctx;
+  roociCtx   *pctx = &(qrys->drv_rodbiQrys->ctx_rodbiDrv);
+  boolean     done;
+  boolean     output;
+  int         cid;
+
+  while (qrys->left_rodbiQrys)
+  {
+    output = FALSE;
+
+    for (cid = 0; cid < qrys->cnt_rodbiQrys; cid++)
+    {
+      rodbiQry  *qry = &qrys->qry_rodbiQrys[cid];
+
+      /* an idle connection takes the next statement */
+      if (!qry->res_rodbiQry)
+      {
+        if (qrys->next_rodbiQrys < LENGTH(qrys->stmt_rodbiQrys))
+          rodbiQrysStart(qry, qrys->next_rodbiQrys++);
+        continue;
+      }
+
+      ROOCI_MUTEX_ACQUIRE(pctx, qrys->mtx_rodbiQrys);
+      done = qry->done_rodbiQry;
+      ROOCI_MUTEX_RELEASE(pctx, qrys->mtx_rodbiQrys);
+
+      /* converted here while the other queries keep running */
+      if (done)
+      {
+        rodbiQrysOutput(qry);
+        output = TRUE;
+      }
+    }
+
+    /* an interrupt unwinds through rodbiQrysFree */
+    if (!output && qrys->left_rodbiQrys)
+    {
+      R_CheckUserInterrupt();
+      roociSleep(1);
+    }
+  }
+
+  return R_NilValue;
+} /* end rodbiQrysRun */
+
+/* ----------------------------- rodbiQrysOutput -------------------------- */
+
+static void rodbiQrysOutput(rodbiQry *qry)
+{
+  rodbiQrys  *qrys   = qry->all_rodbiQry;
+  rodbiCon   *con    = qry->con_rodbiQry;
+  rodbiRes   *res    = qry->res_rodbiQry;
+  text       *errMsg =
+    &(con)->drv_rodbiCon->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  SEXP        hdlRes;
+  SEXP        numRec;
+  size_t      len;
+
+  roociThrJoin(&(con->con_rodbiCon), &qry->tid_rodbiQry, &qry->thd_rodbiQry,
+               FALSE);
+
+  /* error of the worker is on the session of the query */
+  if (qry->rc_rodbiQry != OCI_SUCCESS)
+  {
+    rodbiCheck(con->drv_rodbiCon, con, __func__, __LINE__, qry->rc_rodbiQry,
+               errMsg, ROOCI_ERR_LEN);
+    len = strlen((const char *)errMsg);
+    if (len < ROOCI_ERR_LEN)
+      snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len,
+               RODBI_ERR_QRYS_STMT, qry->qid_rodbiQry + 1);
+    RODBI_ERROR(errMsg);
+  }
+
+  if (qry->arena_rodbiQry)
+  {
+    /* data frame of the rows the worker cached */
+    rodbiResDataFrame(res);
+    SET_VECTOR_ELT(qrys->out_rodbiQrys, qry->qid_rodbiQry,
+                   res->list_rodbiRes);
+    UNPROTECT(2);
+  }
+  else
+  {
+    /* LOB, object and other columns are fetched here as by fetch() */
+    PROTECT(hdlRes = R_MakeExternalPtr((void *)res, R_NilValue, R_NilValue));
+    PROTECT(numRec = ScalarInteger(-1));
+    SET_VECTOR_ELT(qrys->out_rodbiQrys, qry->qid_rodbiQry,
+                   rociResFetch(hdlRes, numRec));
+    R_ClearExternalPtr(hdlRes);
+    UNPROTECT(2);
+  }
+
+  /* the connection takes the next statement */
+  qry->res_rodbiQry = NULL;
+  qrys->left_rodbiQrys--;
+  rodbiResTerm(res);
+} /* end rodbiQrysOutput */
+
+/* ------------------------------ rodbiQrysFree --------------------------- */
+
+static void rodbiQrysFree(void *ctx, Rboolean jump)
+{
+  rodbiQrys  *qrys = (rodbiQrys *)ctx;
+  roociCtx   *pctx = &(qrys->drv_rodbiQrys->ctx_rodbiDrv);
+  boolean     done;
+  int         cid;
+
+  for (cid = 0; qrys->qry_rodbiQrys && (cid < qrys->cnt_rodbiQrys); cid++)
+  {
+    rodbiQry  *qry = &qrys->qry_rodbiQrys[cid];
+    rodbiCon  *con = qry->con_rodbiQry;
+
+    if (!qry->res_rodbiQry)
+      continue;
+
+    /* a query still running is broken on the server */
+    ROOCI_MUTEX_ACQUIRE(pctx, qrys->mtx_rodbiQrys);
+    done = qry->done_rodbiQry;
+    ROOCI_MUTEX_RELEASE(pctx, qrys->mtx_rodbiQrys);
+    roociThrJoin(&(con->con_rodbiCon), &qry->tid_rodbiQry,
+                 &qry->thd_rodbiQry, done ? FALSE : TRUE);
+
+    /* an error is already being raised, this one is not reported */
+    roociResFree(&(qry->res_rodbiQry->res_rodbiRes));
+    (con->con_rodbiCon).num_roociCon--;
+    rodbiResFree(qry->res_rodbiQry);
+    qry->res_rodbiQry = NULL;
+  }
+
+  if (qrys->mtx_rodbiQrys)
+    OCIThreadMutexDestroy(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                          &qrys->mtx_rodbiQrys);
+  if (qrys->qry_rodbiQrys)
+    ROOCI_MEM_FREE(qrys->qry_rodbiQrys);
+  ROOCI_MEM_FREE(qrys);
+} /* end rodbiQrysFree */
+
+
+/* -------------------------- rodbiConInfoResults ------------------------- */
+
+static SEXP rodbiConInfoResults(SEXP conxp)
+{
+  rodbiCon   *con  = rodbiGetCon(conxp);
+  SEXP        list  = R_NilValue;
+  int         resID;
+  int         lstID = 0;
+  int         activeRes = (con->con_rodbiCon).num_roociCon;
+
+  if (activeRes)
+  {
+    /* allocate output list */
+    PROTECT(list = allocVector(VECSXP, activeRes));
+
+    /* set valid result IDs */ 
+    for (resID = 0; resID < (con->con_rodbiCon).max_roociCon; resID++)
+    {
+      roociRes *res = (con->con_rodbiCon).res_roociCon[resID];
+      if (res && rodbiAssertRes(res->parent_roociRes, __func__, 1))
+      {
+        /* allocate result handle */
+        SEXP hdlRes = R_MakeExternalPtr(res->parent_roociRes,
+                                        R_NilValue, R_NilValue);
+        SET_VECTOR_ELT(list, lstID++, hdlRes);              /* protects vec */
+      }
+    }
+
+    /* release output list */
+    UNPROTECT(1);
+  }
+
+  return list;
+} /* end rodbiConInfoResults */
+
+
+/* ----------------------------- rodbiConTerm ----------------------------- */
+  
+static void rodbiConTerm(rodbiCon *con)
+{ 
+  rodbiRes  *res;
+
+  /* Free all results */
+  res = roociGetFirstParentRes(&(con->con_rodbiCon));
+  while(res)
+  {
+    if (!rodbiAssertRes(res, __func__, 1))
+      RODBI_ERROR(RODBI_ERR_INVALID_RES);
+    rodbiResTerm(res);
+    res = roociGetNextParentRes(&(con->con_rodbiCon));
+  }
+
+  /* free connection */
+  RODBI_CHECK_CON(con, __func__, 1, FALSE,
+                  roociTerminateCon(&(con->con_rodbiCon), 1));
+
+  ROOCI_MEM_FREE(con);
+} /* end rodbiConTerm */
+
+
+/****************************************************************************/
+/*  (*) POOL FUNCTIONS                                                      */
+/****************************************************************************/
+
+/* ------------------------------ rodbiGetPool ---------------------------- */
+
+static rodbiPool *rodbiGetPool(SEXP hdlPool)
+{
+  rodbiPool  *pool = R_ExternalPtrAddr(hdlPool);
+
+  /* check validity */
+  if (!pool || (pool->magicWord_rodbiPool != RODBI_CHECKWD))
+    RODBI_ERROR(RODBI_ERR_INVALID_POOL);
+
+  return pool;
+} /* rodbiGetPool */
+
+/* ------------------------------ rodbiPoolTerm --------------------------- */
+
+static void rodbiPoolTerm(rodbiPool *pool)
+{
+  roociCtx   *pctx  = &(pool->drv_rodbiPool->ctx_rodbiDrv);
+  roociPool  *ppool = &(pool->pool_rodbiPool);
+  text       *errMsg = &pctx->loadCtx_roociCtx.message_roociloadCtx[0];
+  int         conID;
+
+  /* release the sessions still taken from the pool */
+  for (conID = 0; ppool->ncon_roociPool && (conID < pctx->max_roociCtx);
+       conID++)
+  {
+    roociCon  *pcon = pctx->con_roociCtx[conID];
+
+    if (pcon && (pcon->pool_roociCon == ppool))
+    {
+      if (!rodbiAssertCon(pcon->parent_roociCon, __func__, 1))
+        RODBI_ERROR(RODBI_ERR_INVALID_CON);
+      rodbiConTerm((rodbiCon *)pcon->parent_roociCon);
+    }
+  }
+
+  /* log off the sessions of the pool */
+  if (roociTerminatePool(ppool) != OCI_SUCCESS)
+  {
+    sb4  errNum = 0;
+
+    *errMsg = 0;
+    roociGetPoolError(ppool, &errNum, errMsg, (ub4)ROOCI_ERR_LEN - 1);
+    RODBI_ERROR(errMsg);
+  }
+
+  pool->magicWord_rodbiPool = 0;
+  ROOCI_MEM_FREE(pool);
+} /* end rodbiPoolTerm */
+
+
+
+/****************************************************************************/
+/*  (*) STATEMENT FUNCTIONS                                                 */
+/****************************************************************************/
+
+/* ------------------------------ rodbiGetRes ----------------------------- */
+
+static rodbiRes *rodbiGetRes(SEXP hdlRes)
+{
+  rodbiRes *res = R_ExternalPtrAddr(hdlRes);
+  
+  /* check validity */
+  if (!res || (res && !rodbiAssertRes(res, __func__, 1)))
+    RODBI_ERROR(RODBI_ERR_INVALID_RES);
+
+  rodbiConWait(res->con_rodbiRes, FALSE);
+
+  return res;
+} /* rodbiGetRes */
+
+/* ---------------------------- rodbiGetResAsync -------------------------- */
+
+static rodbiRes *rodbiGetResAsync(SEXP hdlRes)
+{
+  rodbiRes *res = R_ExternalPtrAddr(hdlRes);
+
+  /* check validity, the caller waits for its statement if it needs to */
+  if (!res || (res && !rodbiAssertRes(res, __func__, 1)))
+    RODBI_ERROR(RODBI_ERR_INVALID_RES);
+
+  return res;
+} /* rodbiGetResAsync */
+
+
+/* ---------------------------- rodbiResExecStmt -------------------------- */
+
+static void rodbiResExecStmt(rodbiRes *res, SEXP data, boolean free_res)
+{
+  /* new data may not fit the DATE binds or the buffers of the first */
+  if ((res->res_rodbiRes).bcnt_roociRes && !res->numOut && !isNull(data))
+  {
+    rodbiResBindDate(res, data, free_res);
+    if (res->styp_rodbiRes != OCI_STMT_SELECT)
+      rodbiResBindGrow(res, data, free_res);
+  }
+
+  switch (res->styp_rodbiRes)
+  {
+  case OCI_STMT_SELECT:
+    rodbiResExecQuery(res, data, free_res);
+    break;
+  default:
+    if ((res->res_rodbiRes).bcnt_roociRes)
+      rodbiResExecBind(res, data, free_res);
+    else
+    {
+      /* execute statement */
+       RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
                        roociStmtExec(&(res->res_rodbiRes), 1, 
                                      res->styp_rodbiRes,
                                      &(res->affrows_rodbiRes)));
+
+       /* the single row in error, if any */
+       if (res->res_rodbiRes.berr_roociRes)
+       {
+         roociBatchErrReset(&(res->res_rodbiRes));
+         RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                         roociBatchErrGet(&(res->res_rodbiRes), 0));
+       }
        
        /* set state */
        res->state_rodbiRes = CLOSE_rodbiState;
@@ -2470,7 +4319,7 @@ static void rodbiResExecQuery(rodbiRes *res, SEXP data, boolean free_res)
     Rprintf(RODBI_ERR_UNSUPP_SQL_ENC);
   }
   else
-    rodbiResBindCopy(res, data, 0, 1, free_res);
+    rodbiResBindCopy(res, data, 0, 1, TRUE, free_res);
 
   /* execute the statement */
   RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
@@ -2560,7 +4409,17 @@ static void rodbiResExecBind(rodbiRes *res, SEXP data, boolean free_res)
   int            end;
   ub4            iters;
   int            rows;
+  int            total = 0;
 
+  /* row errors of a previous execute are replaced */
+  roociBatchErrReset(&(res->res_rodbiRes));
+
+  /* copy each chunk while the previous one is executed */
+  if (rodbiResBindPipe(res, data))
+  {
+    rodbiResExecPipe(res, data, free_res);
+    return;
+  }
 
   /* execute the statement */
   rows = LENGTH(VECTOR_ELT(data, 0));
@@ -2572,19 +4431,30 @@ static void rodbiResExecBind(rodbiRes *res, SEXP data, boolean free_res)
 
     /* copy bind data */
     end = beg + iters;
-    rodbiResBindCopy(res, data, beg, end, free_res);
-    beg = end;
+    rodbiResBindCopy(res, data, beg, end, TRUE, free_res);
 
     /* execute the statement */
     RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
                     roociStmtExec(&(res->res_rodbiRes), iters, 
                                   res->styp_rodbiRes, 
                                   &(res->affrows_rodbiRes)));
+
+    /* rows of this chunk in error, the count covers all chunks */
+    if (res->res_rodbiRes.berr_roociRes)
+    {
+      RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                      roociBatchErrGet(&(res->res_rodbiRes), (ub4)beg));
+      total += res->affrows_rodbiRes;
+    }
   
     /* next chunk */
+    beg   = end;
     rows -= (int)iters;
   }
 
+  if (res->res_rodbiRes.berr_roociRes)
+    res->affrows_rodbiRes = total;
+
   /* set state -if PLSQL OUT then set state to FETCH */
   if (res->numOut)
     res->state_rodbiRes = FETCH_rodbiState;
@@ -2592,14 +4462,116 @@ static void rodbiResExecBind(rodbiRes *res, SEXP data, boolean free_res)
     res->state_rodbiRes = CLOSE_rodbiState;
 } /* end rodbiResExecBind */
 
+/* ---------------------------- rodbiResExecPipe -------------------------- */
+
+static void rodbiResExecPipe(rodbiRes *res, SEXP data, boolean free_res)
+{
+  roociRes      *pres = &(res->res_rodbiRes);
+  int            beg  = 0;
+  int            end;
+  int            prev_beg = 0;
+  int            prev_end = 0;
+  ub4            iters;
+  int            rows;
+  int            bid;
+  int            total    = 0;
+  sword          rc;
+
+  rows = LENGTH(VECTOR_ELT(data, 0));
+  while (rows)
+  {
+    /* get number of rows to process */
+    iters = rows > pres->bmax_roociRes ? pres->bmax_roociRes : rows;
+
+    /* copy bind data into the buffers not being executed */
+    end = beg + iters;
+    rodbiResBindCopy(res, data, beg, end, FALSE, free_res);
+
+    /* previous chunk must be done before the binds are moved */
+    rc = roociPipeExecWait(pres, &(res->affrows_rodbiRes));
+    if (rc != OCI_SUCCESS)
+      rodbiResExecFail(res, rc, prev_beg, prev_end, free_res);
+    if (prev_end && pres->berr_roociRes)
+    {
+      RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                      roociBatchErrGet(pres, (ub4)prev_beg));
+      total += res->affrows_rodbiRes;
+    }
+
+    for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+      rodbiResBindAt(res, bid, VECTOR_ELT(data, bid), beg,
+                     pres->btyp_roociRes[bid].form_roociColType, free_res);
+
+    /* execute this chunk and fill the other buffers with the next */
+    RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                    roociPipeExecStart(pres, iters, res->styp_rodbiRes));
+    roociPipeBindSwap(pres);
+
+    /* next chunk */
+    prev_beg = beg;
+    prev_end = end;
+    beg      = end;
+    rows    -= (int)iters;
+  }
+
+  rc = roociPipeExecWait(pres, &(res->affrows_rodbiRes));
+  if (rc != OCI_SUCCESS)
+    rodbiResExecFail(res, rc, prev_beg, prev_end, free_res);
+  if (pres->berr_roociRes)
+  {
+    RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                    roociBatchErrGet(pres, (ub4)prev_beg));
+    res->affrows_rodbiRes += total;
+  }
+
+  res->state_rodbiRes = CLOSE_rodbiState;
+} /* end rodbiResExecPipe */
+
+/* ---------------------------- rodbiResExecFail -------------------------- */
+
+static void rodbiResExecFail(rodbiRes *res, sword status, int beg, int end,
+                             boolean free_res)
+{
+  text  *errMsg =
+          &(res->con_rodbiRes)->drv_rodbiCon->ctx_rodbiDrv.loadCtx_roociCtx.message_roociloadCtx[0];
+  ub4    done = 0;
+  size_t len;
+
+  /* message of the failed execute, then the row it stopped at */
+  rodbiCheck(res->con_rodbiRes->drv_rodbiCon, res->con_rodbiRes, __func__,
+             __LINE__, status, errMsg, ROOCI_ERR_LEN);
+  roociStmtRowCount(&(res->res_rodbiRes), &done);
+
+  len = strlen((const char *)errMsg);
+  snprintf((char *)errMsg + len, ROOCI_ERR_LEN - len, RODBI_ERR_BIND_ROWS,
+           beg + 1, end, beg + (int)done + 1);
+
+  if (free_res)
+  {
+    if (res->mode_rodbiRes)
+    {
+      ROOCI_MEM_FREE(res->mode_rodbiRes);
+    }
+    roociResFree(&(res->res_rodbiRes));
+    ROOCI_MEM_FREE(res);
+  }
+  RODBI_ERROR(errMsg);
+} /* end rodbiResExecFail */
+
 
 /* ----------------------------- rodbiResBind ----------------------------- */
 
 static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
                          boolean free_res)
 {
-  int  bid;
-  int  data_len = length(data);                     /* elements in data frame */
+  int      bid;
+  int      data_len = length(data);                 /* elements in data frame */
+  boolean  tzset    = FALSE;            /* session time zone looked up once */
+  boolean  lobdata;                      /* LOB values bound as LVC or LVB */
+
+  /* INSERT and UPDATE take LOB values as data, no temporary LOB per value */
+  lobdata = (res->styp_rodbiRes == OCI_STMT_INSERT) ||
+            (res->styp_rodbiRes == OCI_STMT_UPDATE);
 
   /* validate data */
   if (isNull(data))
@@ -2663,6 +4635,7 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
     SEXP        vec = VECTOR_ELT(data, bid);
     SEXP        elem = ((TYPEOF(vec) == VECSXP) ? VECTOR_ELT(vec, 0) : NULL);
     SEXP        el = VECTOR_ELT(data, bid);    
+    boolean     nobuf;
 #define bind_type res->res_rodbiRes.btyp_roociRes[bid].bndtyp_roociColType
 
 #ifdef DEBUG
@@ -2793,11 +4766,27 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
     {
       if (Rf_inherits(vec, RODBI_R_DAT_NM))
       {
-        if (res->con_rodbiRes->con_rodbiCon.timesten_rociCon)
-          (res->res_rodbiRes).btyp_roociRes[bid].extyp_roociColType = SQLT_TIMESTAMP;
+        if (!res->con_rodbiRes->con_rodbiCon.timesten_rociCon && !tzset)
+        {
+          roociSessionTimeZone(&(res->res_rodbiRes));
+          tzset = TRUE;
+        }
+
+        /* written in C as a 7 byte DATE in a fixed offset time zone, see
+           rodbiResBindDate for values that need a TIMESTAMP */
+        if ((res->res_rodbiRes).fixtz_roociRes)
+        {
+          (res->res_rodbiRes).btyp_roociRes[bid].extyp_roociColType = SQLT_DAT;
+          (res->res_rodbiRes).bsiz_roociRes[bid] = (sb4)ROOCI_DATE_LEN;
+        }
         else
-          (res->res_rodbiRes).btyp_roociRes[bid].extyp_roociColType = SQLT_TIMESTAMP_LTZ;
-        (res->res_rodbiRes).bsiz_roociRes[bid] = (ub2)sizeof(OCIDateTime *);
+        {
+          if (res->con_rodbiRes->con_rodbiCon.timesten_rociCon)
+            (res->res_rodbiRes).btyp_roociRes[bid].extyp_roociColType = SQLT_TIMESTAMP;
+          else
+            (res->res_rodbiRes).btyp_roociRes[bid].extyp_roociColType = SQLT_TIMESTAMP_LTZ;
+          (res->res_rodbiRes).bsiz_roociRes[bid] = (ub2)sizeof(OCIDateTime *);
+        }
       }
       else if (Rf_inherits(vec, RODBI_R_DIF_NM) &&
           /* TimesTen binds difftime as SQLT_BDOUBLE */
@@ -2819,7 +4808,15 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
     }
     else if (TYPEOF(vec) == STRSXP)
     {
-      if (bind_type && !strcmp(bind_type, "clob"))
+      if (lobdata && bind_type && !strcmp(bind_type, "clob"))
+      {
+        /* buffer is sized for each chunk in rodbiResBindPack */
+        res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_LVC;
+        res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType |=
+                                      (ROOCI_COL_STR_PACK | ROOCI_COL_LOB_DATA);
+        res->res_rodbiRes.bsiz_roociRes[bid] = 0;
+      }
+      else if (bind_type && !strcmp(bind_type, "clob"))
       {
         res->res_rodbiRes.bsiz_roociRes[bid] = (sb4)sizeof(OCILobLocator *);
         res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_CLOB;
@@ -2836,40 +4833,11 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
       }
       else
       {
-        int    len = LENGTH(VECTOR_ELT(data, 0));
-        int    i;
-        sb8    bndsz = 0;
-
-        /* find the max len of the bind data */
-        for (i=0; i<len; i++)
-        {
-          sb8 ellen = (sb8)strlen(CHAR(STRING_ELT(vec, i)));
-          bndsz = (bndsz < ellen) ? ellen : bndsz;
-        }
-
-        if (bndsz > SB4MAXVAL)
-        {
-          RODBI_ERROR_RES(free_res);
-          Rf_error(RODBI_ERR_BIND_VAL_TOOBIG, bndsz);
-        }
-
-        /* Limitation of OCIBindByPos API, where alen is ub2 for array binds */
-        /* For strings larger than UB2MAXVAL - NULL terminator, use SQLT_LVC */
-        if (bndsz > (UB2MAXVAL -
-                    res->con_rodbiRes->con_rodbiCon.nlsmaxwidth_roociCon))
-        {
-          res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_LVC;
-          bndsz += sizeof(sb4);
-        }
-        else
-        {
-          bndsz += res->con_rodbiRes->con_rodbiCon.nlsmaxwidth_roociCon;
-          res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_STR;
-        }
-
-        /* align buffer to even boundary */
-        bndsz += (sizeof(char *) - (bndsz % sizeof(char *)));
-        res->res_rodbiRes.bsiz_roociRes[bid] = (sb4)bndsz;
+        /* buffer is sized for each chunk in rodbiResBindPack */
+        res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_STR;
+        res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType |=
+                                                           ROOCI_COL_STR_PACK;
+        res->res_rodbiRes.bsiz_roociRes[bid] = 0;
       }
     }
     else if ((elem && (TYPEOF(vec) == VECSXP)) &&
@@ -2885,7 +4853,7 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
            CHAR(STRING_ELT(Rf_getAttrib(vec,
                          Rf_mkString((const char *)"ora.type")), 0));
 
-      if (bind_type && !strcmp(bind_type, "blob"))
+      if (bind_type && !strcmp(bind_type, "blob") && !lobdata)
       {
         res->res_rodbiRes.bsiz_roociRes[bid] = (sb4)sizeof(OCILobLocator *);
         res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_BLOB;
@@ -2917,7 +4885,14 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
 
         /* Limitation of OCIBindByPos API, where alen is ub2 for array binds */
         /* For strings larger than UB2MAXVAL, use SQLT_LVB */
-        if (bndsz > UB2MAXVAL)
+        if (bind_type && !strcmp(bind_type, "blob"))
+        {
+          res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_LVB;
+          res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType |=
+                                                           ROOCI_COL_LOB_DATA;
+          bndsz += sizeof(sb4);
+        }
+        else if (bndsz > UB2MAXVAL)
         {
           res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType = SQLT_LVB;
           bndsz += sizeof(sb4);
@@ -2936,10 +4911,15 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
       Rf_error(RODBI_ERR_UNSUPP_BIND_TYPE);
     }
 
-    /* allocate bind buffers */
-    ROOCI_MEM_ALLOC((res->res_rodbiRes).bdat_roociRes[bid], 
-                    ((res->res_rodbiRes).bmax_roociRes * 
-                    (res->res_rodbiRes).bsiz_roociRes[bid]), sizeof(ub1));
+    /* allocate bind buffers, none for data bound in place in R vector or
+       strings packed for each chunk */
+    nobuf = rodbiBindDirect(res, bid, vec) ||
+            (res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType &
+             ROOCI_COL_STR_PACK);
+    if (!nobuf)
+      ROOCI_MEM_ALLOC((res->res_rodbiRes).bdat_roociRes[bid], 
+                      ((res->res_rodbiRes).bmax_roociRes * 
+                      (res->res_rodbiRes).bsiz_roociRes[bid]), sizeof(ub1));
 
     ROOCI_MEM_ALLOC((res->res_rodbiRes).bind_roociRes[bid],
                     (res->res_rodbiRes).bmax_roociRes, sizeof(sb2));
@@ -2947,7 +4927,7 @@ static void rodbiResBind(rodbiRes *res, SEXP data, int bulk_write,
     ROOCI_MEM_ALLOC((res->res_rodbiRes).alen_roociRes[bid],
                     (res->res_rodbiRes).bmax_roociRes, sizeof(ub2));
 
-    if (!((res->res_rodbiRes).bdat_roociRes[bid]) ||
+    if ((!((res->res_rodbiRes).bdat_roociRes[bid]) && !nobuf) ||
         !((res->res_rodbiRes).bind_roociRes[bid]) ||
         !((res->res_rodbiRes).alen_roociRes[bid]))
     {
@@ -3703,7 +5683,7 @@ static void rodbiPlsqlResBind(rodbiRes *res, SEXP data, int bulk_write,
 /* ---------------------------- rodbiResBindCopy -------------------------- */
 
 static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
-                             boolean free_res)
+                             boolean rebind, boolean free_res)
 {
   int  bid;
   int  i;
@@ -3716,6 +5696,56 @@ static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
     ub2        *alen = (res->res_rodbiRes).alen_roociRes[bid];
     ub1         form_of_use = 0;
 
+    /* numeric and integer vectors are bound where they are */
+    if (rodbiBindDirect(res, bid, elem))
+    {
+      rodbiResBindDirect(res, bid, elem, beg, end);
+      if (rebind)
+        rodbiResBindAt(res, bid, elem, beg, 0, free_res);
+      continue;
+    }
+
+    /* POSIXct is converted in C for a fixed offset session time zone */
+    if ((TYPEOF(elem) == REALSXP) && dat &&
+        (res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_DAT))
+    {
+      roociWriteDateData(&(res->res_rodbiRes), REAL(elem) + beg, end - beg,
+                         dat, ind, alen);
+      if (rebind)
+        rodbiResBindAt(res, bid, elem, beg, 0, free_res);
+      else
+        res->res_rodbiRes.btyp_roociRes[bid].form_roociColType = 0;
+      continue;
+    }
+    if ((TYPEOF(elem) == REALSXP) && dat && !res->numOut &&
+        res->res_rodbiRes.fixtz_roociRes &&
+        (res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType ==
+                                                             SQLT_TIMESTAMP))
+    {
+      RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                      roociWriteTimestampData(&(res->res_rodbiRes),
+                                              (OCIDateTime **)dat,
+                                              REAL(elem) + beg, end - beg,
+                                              ind, alen));
+      if (rebind)
+        rodbiResBindAt(res, bid, elem, beg, 0, free_res);
+      continue;
+    }
+
+    /* strings are packed at the width of the longest value in this chunk */
+    if (res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType &
+        ROOCI_COL_STR_PACK)
+    {
+      rodbiResBindPack(res, bid, elem, beg, end, free_res);
+      dat = (ub1 *)(res->res_rodbiRes).bdat_roociRes[bid];
+    }
+
+    if (!dat)
+    {
+      RODBI_ERROR_RES(free_res);
+      Rf_error(RODBI_ERR_BIND_MISMATCH);
+    }
+
     /* copy vector */
     for (i = beg; i < end; i++)
     {
@@ -3833,7 +5863,7 @@ static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
         else
         {
           const char *str = CHAR(STRING_ELT(elem, i));
-          size_t      len = (sb4)strlen(str);
+          size_t      len = (size_t)LENGTH(STRING_ELT(elem, i));
 
           RODBI_GET_FORM_OF_USE(&form_of_use, elem, i, free_res);
 
@@ -3844,6 +5874,17 @@ static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
             memcpy(pdat->dat_rodbild, str, len);
           }
           else
+          if (((res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_CLOB) ||
+               (res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_BLOB)) &&
+              len)
+          {
+            /* temporary LOB of this row is kept for the next chunk */
+            RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                            roociWriteLOBTemp(&(res->res_rodbiRes), bid,
+                                              i - beg, str, (int)len,
+                                              form_of_use));
+          }
+          else
           if ((res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_CLOB) ||
               (res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_BLOB) ||
               (res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_BFILE))
@@ -3890,6 +5931,22 @@ static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
             rodbild *pdat = (rodbild *)dat;
             pdat->len_rodbild = len;
             memcpy((ub1 *)&pdat->dat_rodbild[0], RAW(x), len);
+
+            /* an empty BLOB is NULL, as with a temporary LOB */
+            if (!len &&
+                (res->res_rodbiRes.btyp_roociRes[bid].bndflg_roociColType &
+                 ROOCI_COL_LOB_DATA))
+              *ind = OCI_IND_NULL;
+          }
+          else
+          if ((res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_BLOB) &&
+              len)
+          {
+            /* temporary LOB of this row is kept for the next chunk */
+            RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                            roociWriteLOBTemp(&(res->res_rodbiRes), bid,
+                                              i - beg, RAW(x), len,
+                                              form_of_use));
           }
           else
           if ((res->res_rodbiRes.btyp_roociRes[bid].extyp_roociColType == SQLT_BLOB) ||
@@ -3929,14 +5986,343 @@ static void rodbiResBindCopy(rodbiRes *res, SEXP data, int beg, int end,
       alen++;
     }
 
-    /* bind data buffers */
-    RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
-                    roociBindData(&(res->res_rodbiRes), (ub4)(bid+1), 
+    /* bind data buffers, or keep form of use until rodbiResBindAt */
+    if (rebind)
+      rodbiResBindAt(res, bid, elem, beg, form_of_use, free_res);
+    else
+      res->res_rodbiRes.btyp_roociRes[bid].form_roociColType = form_of_use;
+  }
+} /* end rodbiResBindCopy */
+
+/* ---------------------------- rodbiBindDirect --------------------------- */
+
+static boolean rodbiBindDirect(rodbiRes *res, int bid, SEXP vec)
+{
+  roociColType  *btyp = &(res->res_rodbiRes).btyp_roociRes[bid];
+  sb4            bsiz = (res->res_rodbiRes).bsiz_roociRes[bid];
+
+  /* PL/SQL OUT binds and objects need a buffer of their own */
+  if (res->numOut || btyp->obtyp_roociColType.otyp_roociObjType)
+    return FALSE;
+
+  if (TYPEOF(vec) == REALSXP)
+    return (btyp->extyp_roociColType == SQLT_BDOUBLE) &&
+           (bsiz == (sb4)sizeof(double));
+
+  if ((TYPEOF(vec) == INTSXP) || (TYPEOF(vec) == LGLSXP))
+    return (btyp->extyp_roociColType == SQLT_INT) &&
+           (bsiz == (sb4)sizeof(int));
+
+  return FALSE;
+} /* end rodbiBindDirect */
+
+/* --------------------------- rodbiResBindDirect ------------------------- */
+
+static void rodbiResBindDirect(rodbiRes *res, int bid, SEXP vec, int beg,
+                               int end)
+{
+  sb2   *ind  = (res->res_rodbiRes).bind_roociRes[bid];
+  ub2   *alen = (res->res_rodbiRes).alen_roociRes[bid];
+  ub2    bsiz = (ub2)(res->res_rodbiRes).bsiz_roociRes[bid];
+  int    cnt  = end - beg;
+  int    i;
+
+  /* only the indicators are filled, OCI reads values from the R vector */
+  if (TYPEOF(vec) == REALSXP)
+  {
+    const double *val = REAL(vec) + beg;
+
+    for (i = 0; i < cnt; i++)
+      ind[i] = (ISNAN(val[i]) && ISNA(val[i])) ? OCI_IND_NULL :
+                                                  OCI_IND_NOTNULL;
+  }
+  else
+  {
+    const int *val = ((TYPEOF(vec) == INTSXP) ? INTEGER(vec) :
+                                                LOGICAL(vec)) + beg;
+
+    for (i = 0; i < cnt; i++)
+      ind[i] = (val[i] == NA_INTEGER) ? OCI_IND_NULL : OCI_IND_NOTNULL;
+  }
+
+  for (i = 0; i < cnt; i++)
+    alen[i] = bsiz;
+} /* end rodbiResBindDirect */
+
+/* ---------------------------- rodbiResBindPack -------------------------- */
+
+static void rodbiResBindPack(rodbiRes *res, int bid, SEXP vec, int beg,
+                             int end, boolean free_res)
+{
+  roociColType  *btyp = &(res->res_rodbiRes).btyp_roociRes[bid];
+  sb4            nlsw = res->con_rodbiRes->con_rodbiCon.nlsmaxwidth_roociCon;
+  sb8            bndsz = 0;
+  size_t         need;
+  int            i;
+
+  /* find the max len of this chunk, CHARSXP lengths need no strlen */
+  for (i = beg; i < end; i++)
+  {
+    SEXP  str = STRING_ELT(vec, i);
+
+    if ((str != NA_STRING) && ((sb8)LENGTH(str) > bndsz))
+      bndsz = (sb8)LENGTH(str);
+  }
+
+  /* Limitation of OCIBindByPos API, where alen is ub2 for array binds */
+  /* For strings larger than UB2MAXVAL - NULL terminator, use SQLT_LVC */
+  if ((bndsz > (UB2MAXVAL - nlsw)) ||
+      (btyp->bndflg_roociColType & ROOCI_COL_LOB_DATA))
+  {
+    btyp->extyp_roociColType = SQLT_LVC;
+    bndsz += sizeof(sb4);
+  }
+  else
+  {
+    btyp->extyp_roociColType = SQLT_STR;
+    bndsz += nlsw;
+  }
+
+  /* align buffer to even boundary */
+  bndsz += (sizeof(char *) - (bndsz % sizeof(char *)));
+  if (bndsz > SB4MAXVAL)
+  {
+    RODBI_ERROR_RES(free_res);
+    Rf_error(RODBI_ERR_BIND_VAL_TOOBIG, bndsz);
+  }
+  (res->res_rodbiRes).bsiz_roociRes[bid] = (sb4)bndsz;
+
+  /* grow the buffer only when this chunk needs more than any before */
+  need = (size_t)bndsz * (size_t)(end - beg);
+  if (need > btyp->bcap_roociColType)
+  {
+    ROOCI_MEM_FREE((res->res_rodbiRes).bdat_roociRes[bid]);
+    btyp->bcap_roociColType = 0;
+    ROOCI_MEM_MALLOC((res->res_rodbiRes).bdat_roociRes[bid], need,
+                     sizeof(ub1));
+    if (!((res->res_rodbiRes).bdat_roociRes[bid]))
+    {
+      RODBI_ERROR_RES(free_res);
+      Rf_error(RODBI_ERR_MEMORY_ALC);
+    }
+    btyp->bcap_roociColType = need;
+  }
+} /* end rodbiResBindPack */
+
+/* ----------------------------- rodbiResBindAt --------------------------- */
+
+static void rodbiResBindAt(rodbiRes *res, int bid, SEXP vec, int beg,
+                           ub1 form_of_use, boolean free_res)
+{
+  void  *dat = NULL;
+
+  /* data bound in place is at this chunk of the R vector */
+  if (rodbiBindDirect(res, bid, vec))
+  {
+    if (TYPEOF(vec) == REALSXP)
+      dat = (void *)(REAL(vec) + beg);
+    else if (TYPEOF(vec) == INTSXP)
+      dat = (void *)(INTEGER(vec) + beg);
+    else
+      dat = (void *)(LOGICAL(vec) + beg);
+  }
+
+  RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                  roociBindData(&(res->res_rodbiRes), (ub4)(bid + 1), dat,
                       form_of_use,
                       res->res_rodbiRes.btyp_roociRes[bid].bndnm_roociColType));
+} /* end rodbiResBindAt */
 
+/* ---------------------------- rodbiResBindPipe -------------------------- */
+
+static boolean rodbiResBindPipe(rodbiRes *res, SEXP data)
+{
+  roociRes  *pres = &(res->res_rodbiRes);
+
+  /* a single chunk, PL/SQL output, interruptible execute or an environment
+     that is not threaded run as before */
+  if (!res->pipe_rodbiRes || res->numOut ||
+      (LENGTH(VECTOR_ELT(data, 0)) <= pres->bmax_roociRes) ||
+      res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv.control_c_roociCtx ||
+      !res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv.threaded_roociCtx)
+    return FALSE;
+
+  /* bind copy must not call OCI while the previous chunk is executed */
+  if (!rodbiResBindPlain(res))
+    return FALSE;
+
+  return (roociPipeBindInit(pres) == OCI_SUCCESS);
+} /* end rodbiResBindPipe */
+
+/* --------------------------- rodbiResBindPlain -------------------------- */
+
+static boolean rodbiResBindPlain(rodbiRes *res)
+{
+  roociRes  *pres = &(res->res_rodbiRes);
+  int        bid;
+
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    roociColType  *btyp = &pres->btyp_roociRes[bid];
+
+    if (btyp->obtyp_roociColType.otyp_roociObjType ||
+        (btyp->bndflg_roociColType & ROOCI_COL_VEC_AS_CLOB))
+      return FALSE;
+
+    switch (btyp->extyp_roociColType)
+    {
+    case SQLT_BDOUBLE:
+    case SQLT_INT:
+    case SQLT_STR:
+    case SQLT_LVC:
+    case SQLT_BIN:
+    case SQLT_LVB:
+    case SQLT_DAT:
+      break;
+
+    default:
+      return FALSE;
+    }
   }
-} /* end rodbiResBindCopy */
+
+  return TRUE;
+} /* end rodbiResBindPlain */
+
+/* --------------------------- rodbiResBindDate --------------------------- */
+
+static void rodbiResBindDate(rodbiRes *res, SEXP data, boolean free_res)
+{
+  roociRes  *pres = &(res->res_rodbiRes);
+  int        bid;
+
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    SEXP  vec = VECTOR_ELT(data, bid);
+
+    if ((pres->btyp_roociRes[bid].extyp_roociColType != SQLT_DAT) ||
+        ((TYPEOF(vec) == REALSXP) &&
+         roociDateFits(pres, REAL(vec), LENGTH(vec))))
+      continue;
+
+    /* fractional seconds or years out of range of DATE, this column stays
+       a TIMESTAMP for later executes */
+    ROOCI_MEM_FREE(pres->bdat_roociRes[bid]);
+    pres->btyp_roociRes[bid].extyp_roociColType = SQLT_TIMESTAMP;
+    pres->bsiz_roociRes[bid] = (sb4)sizeof(OCIDateTime *);
+
+    ROOCI_MEM_ALLOC(pres->bdat_roociRes[bid], pres->bmax_roociRes,
+                    sizeof(OCIDateTime *));
+    if (!pres->bdat_roociRes[bid])
+    {
+      RODBI_ERROR_RES(free_res);
+      Rf_error(RODBI_ERR_MEMORY_ALC);
+    }
+
+    RODBI_CHECK_RES(res, __func__, __LINE__, free_res,
+                    roociAllocDescBindBuf(pres,
+                                          (void **)pres->bdat_roociRes[bid],
+                                          pres->bsiz_roociRes[bid],
+                                          (ub4)OCI_DTYPE_TIMESTAMP));
+  }
+} /* end rodbiResBindDate */
+
+/* --------------------------- rodbiResBindGrow --------------------------- */
+
+static void rodbiResBindGrow(rodbiRes *res, SEXP data, boolean free_res)
+{
+  roociRes  *pres = &(res->res_rodbiRes);
+  int        rows = LENGTH(VECTOR_ELT(data, 0));
+  int        bmax = pres->bmax_roociRes;
+  boolean    grow = FALSE;
+  boolean    wide = FALSE;
+  int        bid;
+  int        i;
+
+  /* descriptors and LOBs keep the rows they were allocated for */
+  if (!rodbiResBindPlain(res))
+    return;
+
+  /* the first data may have had fewer rows than bulk_write */
+  if ((rows > bmax) && (bmax < res->nrows_write_rodbiRes))
+  {
+    bmax = (rows > res->nrows_write_rodbiRes) ? res->nrows_write_rodbiRes :
+                                                rows;
+    grow = TRUE;
+  }
+
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    roociColType  *btyp = &pres->btyp_roociRes[bid];
+    SEXP           vec  = VECTOR_ELT(data, bid);
+    boolean        copy = FALSE;
+
+    /* raw values longer than any before need wider rows */
+    if (((btyp->extyp_roociColType == SQLT_BIN) ||
+         (btyp->extyp_roociColType == SQLT_LVB)) && (TYPEOF(vec) == VECSXP))
+    {
+      sb8  need = 0;
+      sb8  have = pres->bsiz_roociRes[bid];
+
+      if (btyp->extyp_roociColType == SQLT_LVB)
+        have -= sizeof(sb4);
+      for (i = 0; i < rows; i++)
+      {
+        sb8 ellen = (sb8)(LENGTH(VECTOR_ELT(vec, i)));
+        need = (need < ellen) ? ellen : need;
+      }
+
+      if (need > have)
+      {
+        if (need > SB4MAXVAL)
+        {
+          RODBI_ERROR_RES(free_res);
+          Rf_error(RODBI_ERR_BIND_VAL_TOOBIG, need);
+        }
+
+        if (need > UB2MAXVAL)
+          btyp->extyp_roociColType = SQLT_LVB;
+        if (btyp->extyp_roociColType == SQLT_LVB)
+          need += sizeof(sb4);
+        need += (sizeof(char *) - (need % sizeof(char *)));
+        pres->bsiz_roociRes[bid] = (sb4)need;
+        copy = wide = TRUE;
+      }
+    }
+
+    /* strings are packed for each chunk, numbers may be bound in place */
+    if ((grow || copy) && pres->bdat_roociRes[bid] &&
+        !(btyp->bndflg_roociColType & ROOCI_COL_STR_PACK))
+    {
+      ROOCI_MEM_FREE(pres->bdat_roociRes[bid]);
+      ROOCI_MEM_ALLOC(pres->bdat_roociRes[bid],
+                      ((size_t)bmax * (size_t)pres->bsiz_roociRes[bid]),
+                      sizeof(ub1));
+      if (!pres->bdat_roociRes[bid])
+      {
+        RODBI_ERROR_RES(free_res);
+        Rf_error(RODBI_ERR_MEMORY_ALC);
+      }
+    }
+
+    if (grow)
+    {
+      ROOCI_MEM_FREE(pres->bind_roociRes[bid]);
+      ROOCI_MEM_FREE(pres->alen_roociRes[bid]);
+      ROOCI_MEM_ALLOC(pres->bind_roociRes[bid], bmax, sizeof(sb2));
+      ROOCI_MEM_ALLOC(pres->alen_roociRes[bid], bmax, sizeof(ub2));
+      if (!pres->bind_roociRes[bid] || !pres->alen_roociRes[bid])
+      {
+        RODBI_ERROR_RES(free_res);
+        Rf_error(RODBI_ERR_MEMORY_ALC);
+      }
+    }
+  }
+
+  /* spare buffers of a pipelined execute are allocated again */
+  if (grow || wide)
+    roociPipeBindFree(pres);
+  pres->bmax_roociRes = bmax;
+} /* end rodbiResBindGrow */
 
 /* ----------------------------- rodbiResAlloc ---------------------------- */
 
@@ -3954,75 +6340,433 @@ static void rodbiResAlloc(rodbiRes *res, int nrow)
   /* allocate column vectors */
   for (cid = 0; cid < ncol; cid++)
   {
-    /* allocate column vector */
-    SET_VECTOR_ELT(res->list_rodbiRes, cid, allocVector(
+    /* allocate column vector, integer codes for factors */
+    if (res->kern_rodbiRes &&
+        ((res->kern_rodbiRes[cid] == FAC_rodbiKern) ||
+         (res->kern_rodbiRes[cid] == FUC_rodbiKern)))
+      SET_VECTOR_ELT(res->list_rodbiRes, cid, allocVector(INTSXP, nrow));
+    else
+      SET_VECTOR_ELT(res->list_rodbiRes, cid, allocVector(
         RODBI_TYPE_SXP((res->res_rodbiRes).typ_roociRes[cid].typ_roociColType),
         nrow));
 
-    /* get column name & parameters */
-    RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-                    roociGetColProperties(&(res->res_rodbiRes), 
-                                          (ub4)(cid+1), &len, &buf));
+    /* get column name & parameters */
+    RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                    roociGetColProperties(&(res->res_rodbiRes), 
+                                          (ub4)(cid+1), &len, &buf));
+
+    /* set column name */
+    SET_STRING_ELT(res->name_rodbiRes, cid,
+                   mkCharLen((const char *)buf, (int)len));
+  }
+
+  /* set names attribute */
+  setAttrib(res->list_rodbiRes, R_NamesSymbol, res->name_rodbiRes);
+
+  /* set the state */
+  if (!res->arena_rodbiRes)
+  {
+    res->nrow_rodbiRes = nrow;
+    res->rows_rodbiRes = 0;
+  }
+
+} /* end rodbiResAlloc */
+
+/* ---------------------------- rodbiResExpand ---------------------------- */
+
+static void rodbiResExpand(rodbiRes *res)
+{
+  int nrow = res->rows_rodbiRes + res->fchNum_rodbiRes - res->fchBeg_rodbiRes;
+  int ncol = (res->res_rodbiRes).ncol_roociRes;
+  int cid;
+
+  if (!(res->expand_rodbiRes) || (res->nrow_rodbiRes > nrow) || (nrow == 0))
+    return;
+
+  /* compute new size */
+  while (res->nrow_rodbiRes <= nrow)
+    res->nrow_rodbiRes *= 2;
+
+  if (!res->arena_rodbiRes)
+  {
+    /* expand column vectors */
+    for (cid = 0; cid < ncol; cid++)
+    {
+      SEXP vec = VECTOR_ELT(res->list_rodbiRes, cid);
+      vec = lengthgets(vec, res->nrow_rodbiRes);
+      SET_VECTOR_ELT(res->list_rodbiRes, cid, vec);          /* protects vec */
+    }
+  }
+} /* end rodbiResExpand */
+
+/* ----------------------------- rodbiResSplit ---------------------------- */
+
+static void rodbiResSplit(rodbiRes *res)
+{
+  int fchEnd;
+
+  /* set position after the end of the chunk */
+  fchEnd = res->fchBeg_rodbiRes + res->nrow_rodbiRes - res->rows_rodbiRes;
+
+  /* adjust based on the buffer size */
+  if (fchEnd > res->fchNum_rodbiRes)
+    res->fchEnd_rodbiRes = res->fchNum_rodbiRes;
+  else
+    res->fchEnd_rodbiRes = fchEnd;
+} /* end rodbiResSplit */
+
+/* ----------------------------- rodbiResKernel --------------------------- */
+
+static void rodbiResKernel(rodbiRes *res)
+{
+  if (rodbiResKernelSel(res) != OCI_SUCCESS)
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+} /* end rodbiResKernel */
+
+/* ---------------------------- rodbiResKernelSel ------------------------- */
+
+static sword rodbiResKernelSel(rodbiRes *res)
+{
+  roociRes   *pres = &(res->res_rodbiRes);
+  int         cid;
+
+  if (res->kern_rodbiRes)
+    ROOCI_MEM_FREE(res->kern_rodbiRes);
+
+  ROOCI_MEM_ALLOC(res->kern_rodbiRes,
+                  (pres->ncol_roociRes ? pres->ncol_roociRes : 1),
+                  sizeof(ub1));
+  if (!res->kern_rodbiRes)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+
+  if (res->scache_rodbiRes)
+    ROOCI_MEM_FREE(res->scache_rodbiRes);
+
+  /* factor columns are selected again for a new cursor */
+  if (res->dict_rodbiRes)
+  {
+    for (cid = 0; cid < pres->ncol_roociRes; cid++)
+      rodbiDictFree(&res->dict_rodbiRes[cid]);
+    ROOCI_MEM_FREE(res->dict_rodbiRes);
+  }
+
+  ROOCI_MEM_ALLOC(res->scache_rodbiRes,
+                  (pres->ncol_roociRes ? pres->ncol_roociRes : 1),
+                  sizeof(rodbiSCache));
+  if (!res->scache_rodbiRes)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+
+  /* new defines always use the define buffers */
+  res->direct_rodbiRes = FALSE;
+
+  /*
+  ** Pick the conversion once per column so that the accumulation loops do
+  ** not need to switch on the R and external types for every cell.
+  */
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    ub1        rtyp = RODBI_TYPE_R(pres->typ_roociRes[cid].typ_roociColType);
+    ub2        etyp = pres->typ_roociRes[cid].extyp_roociColType;
+    rodbiKern  kern = GEN_rodbiKern;
+
+    switch (etyp)
+    {
+    case SQLT_INT:
+      if (rtyp == RODBI_R_INT)
+        kern = INT_rodbiKern;
+      break;
+
+    case SQLT_BDOUBLE:
+    case SQLT_FLT:
+      if (rtyp == RODBI_R_NUM)
+        kern = FLT_rodbiKern;
+      break;
+
+    case SQLT_STR:
+      if (rtyp != RODBI_R_CHR)
+        break;
+      if (res->con_rodbiRes->con_rodbiCon.timesten_rociCon &&
+          (pres->form_roociRes[cid] == SQLCS_NCHAR) &&
+          res->con_rodbiRes->drv_rodbiCon->unicode_as_utf8)
+        kern = UCS_rodbiKern;
+      else
+        kern = STR_rodbiKern;
+      break;
+
+    case SQLT_BIN:
+      if (rtyp == RODBI_R_RAW)
+        kern = BIN_rodbiKern;
+      break;
+
+    case SQLT_DAT:
+      if (rtyp == RODBI_R_DAT)
+        kern = DTN_rodbiKern;
+      break;
+
+    case SQLT_TIMESTAMP_LTZ:
+      if (rtyp == RODBI_R_DAT)
+        kern = DAT_rodbiKern;
+      break;
+
+    case SQLT_INTERVAL_DS:
+      if (rtyp == RODBI_R_DIF)
+        kern = DIF_rodbiKern;
+      break;
+
+    default:
+      break;
+    }
+
+    res->kern_rodbiRes[cid] = (ub1)kern;
+  }
+
+  return OCI_SUCCESS;
+} /* end rodbiResKernelSel */
+
+/* ----------------------------- rodbiResDirect --------------------------- */
+
+static void rodbiResDirect(rodbiRes *res)
+{
+  roociRes   *pres   = &(res->res_rodbiRes);
+  int         nfch   = pres->prefetch_roociRes ? 1 : pres->nrows_roociRes;
+  boolean     direct = FALSE;
+  int         cid;
+
+  /*
+  ** Integer and double columns can be fetched straight into the output
+  ** vectors at the current row when the data frame is not cached and the
+  ** vectors have room for a whole fetch. Vectors may be reallocated between
+  ** fetches, so the defines are pointed again before every fetch.
+  */
+  if (pres->nocache_roociRes && !res->arena_rodbiRes && res->kern_rodbiRes &&
+      ((res->nrow_rodbiRes - res->rows_rodbiRes) >= nfch))
+    direct = TRUE;
+
+  /* defines already at the define buffers */
+  if (!direct && !res->direct_rodbiRes)
+    return;
+
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    void *dat = NULL;
+
+    if ((res->kern_rodbiRes[cid] != INT_rodbiKern) &&
+        (res->kern_rodbiRes[cid] != FLT_rodbiKern))
+      continue;
+
+    if (direct)
+    {
+      SEXP vec = VECTOR_ELT(res->list_rodbiRes, cid);
+
+      if (res->kern_rodbiRes[cid] == INT_rodbiKern)
+        dat = (void *)(INTEGER(vec) + res->rows_rodbiRes);
+      else
+        dat = (void *)(REAL(vec) + res->rows_rodbiRes);
+    }
+
+    RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                    roociResDefineAt(pres, cid, dat, NULL, NULL));
+  }
+
+  res->direct_rodbiRes = direct;
+} /* end rodbiResDirect */
+
+/* ---------------------------- rodbiSCacheReset -------------------------- */
+
+static void rodbiSCacheReset(rodbiRes *res)
+{
+  int cid;
+
+  if (!res->scache_rodbiRes)
+    return;
+
+  /*
+  ** Cached CHARSXPs are only kept alive by the vectors of the current fetch,
+  ** hit statistics and the enabled state are kept for the result set.
+  */
+  for (cid = 0; cid < res->res_rodbiRes.ncol_roociRes; cid++)
+    memset(res->scache_rodbiRes[cid].chr_rodbiSCache, 0,
+           sizeof(res->scache_rodbiRes[cid].chr_rodbiSCache));
+} /* end rodbiSCacheReset */
+
+/* ---------------------------- rodbiSCacheMkChar ------------------------- */
+
+static SEXP rodbiSCacheMkChar(rodbiSCache *sc, const char *dat, int len,
+                              cetype_t enc)
+{
+  SEXP  chr;
+  ub4   hash;
+
+  if (sc->off_rodbiSCache)
+    return Rf_mkCharLenCE(dat, len, enc);
+
+  hash = rodbiStrHash(dat, len);
+
+  chr = sc->chr_rodbiSCache[hash & (RODBI_SCACHE_SIZE - 1)];
+  sc->lkp_rodbiSCache++;
+  sc->wlkp_rodbiSCache++;
+
+  /* encoding is the same for all values of a column */
+  if (chr && (LENGTH(chr) == len) && !memcmp(CHAR(chr), dat, len))
+  {
+    sc->hit_rodbiSCache++;
+    sc->whit_rodbiSCache++;
+  }
+  else
+  {
+    chr = Rf_mkCharLenCE(dat, len, enc);
+    sc->chr_rodbiSCache[hash & (RODBI_SCACHE_SIZE - 1)] = chr;
+  }
+
+  /* turn the cache off for high cardinality columns */
+  if (sc->wlkp_rodbiSCache == RODBI_SCACHE_PROBE)
+  {
+    if ((sc->whit_rodbiSCache * 100) <
+        (RODBI_SCACHE_PROBE * RODBI_SCACHE_MIN_HIT))
+      sc->off_rodbiSCache = TRUE;
+    sc->wlkp_rodbiSCache = 0;
+    sc->whit_rodbiSCache = 0;
+  }
+
+  return chr;
+} /* end rodbiSCacheMkChar */
+
+/* ------------------------------ rodbiStrHash ---------------------------- */
+
+static ub4 rodbiStrHash(const char *dat, int len)
+{
+  ub4   hash = 2166136261U;                          /* FNV-1a offset basis */
+  int   i;
+
+  for (i = 0; i < len; i++)
+    hash = (hash ^ (ub1)dat[i]) * 16777619U;
+
+  return hash;
+} /* end rodbiStrHash */
+
+/* ----------------------------- rodbiDictCode ---------------------------- */
+
+static int rodbiDictCode(rodbiDict *dict, const char *dat, int len)
+{
+  ub4   hash = rodbiStrHash(dat, len);
+  int   slot;
+  int   lev;
+  int   i;
+
+  /* keep the hash table at most half full */
+  if ((dict->nlev_rodbiDict * 2) >= dict->tabsz_rodbiDict)
+  {
+    int    tabsz = dict->tabsz_rodbiDict ? (dict->tabsz_rodbiDict * 2) :
+                                           RODBI_DICT_SIZE;
+    int   *tab;
+    void  *tmp;
+
+    ROOCI_MEM_ALLOC(tab, tabsz, sizeof(int));
+    if (!tab)
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+
+    /* level arrays grow with the table */
+    ROOCI_MEM_REALLOC(tmp, dict->hash_rodbiDict, tabsz / 2, sizeof(ub4));
+    if (!tmp)
+    {
+      ROOCI_MEM_FREE(tab);
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+    }
+    dict->hash_rodbiDict = (ub4 *)tmp;
+
+    ROOCI_MEM_REALLOC(tmp, dict->len_rodbiDict, tabsz / 2, sizeof(int));
+    if (!tmp)
+    {
+      ROOCI_MEM_FREE(tab);
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+    }
+    dict->len_rodbiDict = (int *)tmp;
+
+    ROOCI_MEM_REALLOC(tmp, dict->dat_rodbiDict, tabsz / 2, sizeof(char *));
+    if (!tmp)
+    {
+      ROOCI_MEM_FREE(tab);
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+    }
+    dict->dat_rodbiDict = (char **)tmp;
+
+    /* rehash existing levels */
+    for (i = 0; i < dict->nlev_rodbiDict; i++)
+    {
+      slot = (int)(dict->hash_rodbiDict[i] & (ub4)(tabsz - 1));
+      while (tab[slot])
+        slot = (slot + 1) & (tabsz - 1);
+      tab[slot] = i + 1;
+    }
 
-    /* set column name */
-    SET_STRING_ELT(res->name_rodbiRes, cid,
-                   mkCharLen((const char *)buf, (int)len));
+    if (dict->tab_rodbiDict)
+      ROOCI_MEM_FREE(dict->tab_rodbiDict);
+    dict->tab_rodbiDict   = tab;
+    dict->tabsz_rodbiDict = tabsz;
   }
 
-  /* set names attribute */
-  setAttrib(res->list_rodbiRes, R_NamesSymbol, res->name_rodbiRes);
-
-  /* set the state */
-  if (!res->pghdl_rodbiRes)
+  /* probe linearly for the value */
+  slot = (int)(hash & (ub4)(dict->tabsz_rodbiDict - 1));
+  while ((lev = dict->tab_rodbiDict[slot]) != 0)
   {
-    res->nrow_rodbiRes = nrow;
-    res->rows_rodbiRes = 0;
+    if ((dict->hash_rodbiDict[lev - 1] == hash) &&
+        (dict->len_rodbiDict[lev - 1] == len)   &&
+        !memcmp(dict->dat_rodbiDict[lev - 1], dat, len))
+      return lev;
+    slot = (slot + 1) & (dict->tabsz_rodbiDict - 1);
   }
 
-} /* end rodbiResAlloc */
+  /* add a new level */
+  lev = dict->nlev_rodbiDict;
+  ROOCI_MEM_MALLOC(dict->dat_rodbiDict[lev], (len ? len : 1), sizeof(char));
+  if (!dict->dat_rodbiDict[lev])
+    RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  memcpy(dict->dat_rodbiDict[lev], dat, len);
+  dict->hash_rodbiDict[lev] = hash;
+  dict->len_rodbiDict[lev]  = len;
+  dict->nlev_rodbiDict++;
+  dict->tab_rodbiDict[slot] = lev + 1;
 
-/* ---------------------------- rodbiResExpand ---------------------------- */
+  return lev + 1;
+} /* end rodbiDictCode */
 
-static void rodbiResExpand(rodbiRes *res)
-{
-  int nrow = res->rows_rodbiRes + res->fchNum_rodbiRes - res->fchBeg_rodbiRes;
-  int ncol = (res->res_rodbiRes).ncol_roociRes;
-  int cid;
+/* ---------------------------- rodbiDictLevels --------------------------- */
 
-  if (!(res->expand_rodbiRes) || (res->nrow_rodbiRes > nrow) || (nrow == 0))
-    return;
+static SEXP rodbiDictLevels(rodbiDict *dict, cetype_t enc)
+{
+  SEXP  lev;
+  int   i;
 
-  /* compute new size */
-  while (res->nrow_rodbiRes <= nrow)
-    res->nrow_rodbiRes *= 2;
+  PROTECT(lev = allocVector(STRSXP, dict->nlev_rodbiDict));
+  for (i = 0; i < dict->nlev_rodbiDict; i++)
+    SET_STRING_ELT(lev, i, Rf_mkCharLenCE(dict->dat_rodbiDict[i],
+                                          dict->len_rodbiDict[i], enc));
+  UNPROTECT(1);
 
-  if (!res->pghdl_rodbiRes)
-  {
-    /* expand column vectors */
-    for (cid = 0; cid < ncol; cid++)
-    {
-      SEXP vec = VECTOR_ELT(res->list_rodbiRes, cid);
-      vec = lengthgets(vec, res->nrow_rodbiRes);
-      SET_VECTOR_ELT(res->list_rodbiRes, cid, vec);          /* protects vec */
-    }
-  }
-} /* end rodbiResExpand */
+  return lev;
+} /* end rodbiDictLevels */
 
-/* ----------------------------- rodbiResSplit ---------------------------- */
+/* ----------------------------- rodbiDictFree ---------------------------- */
 
-static void rodbiResSplit(rodbiRes *res)
+static void rodbiDictFree(rodbiDict *dict)
 {
-  int fchEnd;
+  int   i;
 
-  /* set position after the end of the chunk */
-  fchEnd = res->fchBeg_rodbiRes + res->nrow_rodbiRes - res->rows_rodbiRes;
+  for (i = 0; i < dict->nlev_rodbiDict; i++)
+    ROOCI_MEM_FREE(dict->dat_rodbiDict[i]);
 
-  /* adjust based on the buffer size */
-  if (fchEnd > res->fchNum_rodbiRes)
-    res->fchEnd_rodbiRes = res->fchNum_rodbiRes;
-  else
-    res->fchEnd_rodbiRes = fchEnd;
-} /* end rodbiResSplit */
+  if (dict->tab_rodbiDict)
+    ROOCI_MEM_FREE(dict->tab_rodbiDict);
+  if (dict->hash_rodbiDict)
+    ROOCI_MEM_FREE(dict->hash_rodbiDict);
+  if (dict->len_rodbiDict)
+    ROOCI_MEM_FREE(dict->len_rodbiDict);
+  if (dict->dat_rodbiDict)
+    ROOCI_MEM_FREE(dict->dat_rodbiDict);
+
+  dict->nlev_rodbiDict  = 0;
+  dict->tabsz_rodbiDict = 0;
+} /* end rodbiDictFree */
 
 /* ----------------------------- rodbiResAccum ---------------------------- */
 
@@ -4064,6 +6808,13 @@ static void rodbiResAccum(rodbiRes *res)
     else
       enc = CE_NATIVE;
 
+    /* use the kernel selected for this column at define time */
+    if (res->kern_rodbiRes[cid] != GEN_rodbiKern)
+    {
+      rodbiResAccumKernel(res, cid, vec, enc, &tempbuf, &tempbuflen);
+      continue;
+    }
+
     for (fcur = fbeg, lcur = rows; fcur < fend; fcur++, lcur++)
     {
       /* copy data */
@@ -4194,22 +6945,19 @@ static void rodbiResAccum(rodbiRes *res)
 
         case SQLT_CLOB:
           {
-            OCILobLocator *lob_loc =
-              *(OCILobLocator **)((ub1 *)res->res_rodbiRes.dat_roociRes[cid] +
-                                 (fcur * res->res_rodbiRes.siz_roociRes[cid]));
+            ub1 *lob_dat;
 
             /* read LOB data */
             RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-                            roociReadLOBData(&(res->res_rodbiRes),
-                                        lob_loc, &lob_len,
-                                        res->res_rodbiRes.form_roociRes[cid]));
+                            roociReadLOBCell(&(res->res_rodbiRes), cid, fcur,
+                                             &lob_dat, &lob_len));
 
             if ((res->con_rodbiRes->con_rodbiCon.timesten_rociCon) &&
                 (enc == CE_UTF8))
             {
               RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
                 rodbiTTConvertUCS2UTF8Data(&(res->res_rodbiRes),
-                            (const ub2 *)res->res_rodbiRes.lobbuf_roociRes,
+                            (const ub2 *)lob_dat,
                             (size_t)(lob_len),
                             &tempbuf, &tempbuflen));
 
@@ -4218,8 +6966,8 @@ static void rodbiResAccum(rodbiRes *res)
             }
             else
               /* make character element */
-              SET_STRING_ELT(vec, lcur, mkCharLenCE((const char *)
-                         ((res->res_rodbiRes).lobbuf_roociRes), lob_len, enc));
+              SET_STRING_ELT(vec, lcur, mkCharLenCE((const char *)lob_dat,
+                                                    lob_len, enc));
           }
           break;
 
@@ -4228,21 +6976,16 @@ static void rodbiResAccum(rodbiRes *res)
           {
             SEXP rawVec;
             Rbyte *b;
-
-            OCILobLocator *lob_loc =
-              *(OCILobLocator **)((ub1 *)res->res_rodbiRes.dat_roociRes[cid] +
-                                  (fcur * res->res_rodbiRes.siz_roociRes[cid]));
+            ub1 *lob_dat;
 
             /* read LOB data */
             RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-                  roociReadBLOBData(&(res->res_rodbiRes), lob_loc, &lob_len,
-                      res->res_rodbiRes.form_roociRes[cid],
-                      res->res_rodbiRes.typ_roociRes[cid].extyp_roociColType));
+                            roociReadLOBCell(&(res->res_rodbiRes), cid, fcur,
+                                             &lob_dat, &lob_len));
 
             PROTECT(rawVec = NEW_RAW(lob_len));
             b = RAW(rawVec);
-            memcpy((void *)b, (void *)res->res_rodbiRes.lobbuf_roociRes,
-                   lob_len);
+            memcpy((void *)b, (void *)lob_dat, lob_len);
             SET_VECTOR_ELT(vec,  lcur, rawVec);
             UNPROTECT(1);
           }
@@ -4320,6 +7063,202 @@ static void rodbiResAccum(rodbiRes *res)
   res->fchBeg_rodbiRes = res->fchEnd_rodbiRes;
 } /* end rodbiResAccum */
 
+/* -------------------------- rodbiResAccumKernel ------------------------- */
+
+static void rodbiResAccumKernel(rodbiRes *res, int cid, SEXP vec,
+                                cetype_t enc, char **tempbuf,
+                                size_t *tempbuflen)
+{
+  roociRes   *pres = &(res->res_rodbiRes);
+  int         fbeg = res->fchBeg_rodbiRes;
+  int         nrow = res->fchEnd_rodbiRes - res->fchBeg_rodbiRes;
+  int         rows = res->rows_rodbiRes;
+  sb4         siz  = pres->siz_roociRes[cid];
+  ub1        *dat  = (ub1 *)pres->dat_roociRes[cid] + (fbeg * siz);
+  sb2        *ind  = pres->ind_roociRes[cid] + fbeg;
+  ub2        *len  = pres->len_roociRes[cid] + fbeg;
+  double      tstm;
+  int         i;
+  int         j;
+
+  switch (res->kern_rodbiRes[cid])
+  {
+  case INT_rodbiKern:
+    {
+      int  *src = (int *)dat;
+      int  *dst = INTEGER(vec) + rows;
+
+      /* data fetched in place only needs NULLs patched */
+      if (res->direct_rodbiRes)
+      {
+        for (i = rodbiNextNull(ind, 0, nrow); i < nrow;
+             i = rodbiNextNull(ind, i + 1, nrow))
+          dst[i] = NA_INTEGER;
+      }
+      else
+        /* copy each run of non-NULL values in one go */
+        for (i = 0; i < nrow; i = j + 1)
+        {
+          j = rodbiNextNull(ind, i, nrow);
+          if (j > i)
+            memcpy(dst + i, src + i, (j - i) * sizeof(int));
+          if (j < nrow)
+            dst[j] = NA_INTEGER;
+        }
+    }
+    break;
+
+  case FLT_rodbiKern:
+    {
+      double *src = (double *)dat;
+      double *dst = REAL(vec) + rows;
+
+      /* data fetched in place only needs NULLs patched */
+      if (res->direct_rodbiRes)
+      {
+        for (i = rodbiNextNull(ind, 0, nrow); i < nrow;
+             i = rodbiNextNull(ind, i + 1, nrow))
+          dst[i] = NA_REAL;
+      }
+      else
+        /* copy each run of non-NULL values in one go */
+        for (i = 0; i < nrow; i = j + 1)
+        {
+          j = rodbiNextNull(ind, i, nrow);
+          if (j > i)
+            memcpy(dst + i, src + i, (j - i) * sizeof(double));
+          if (j < nrow)
+            dst[j] = NA_REAL;
+        }
+    }
+    break;
+
+  case STR_rodbiKern:
+    for (i = 0; i < nrow; i++, dat += siz)
+    {
+      if (ind[i] == OCI_IND_NULL)
+        SET_STRING_ELT(vec, rows + i, NA_STRING);
+      else
+        SET_STRING_ELT(vec, rows + i,
+                       rodbiSCacheMkChar(&res->scache_rodbiRes[cid],
+                                         (char *)dat, len[i], enc));
+    }
+    break;
+
+  case UCS_rodbiKern:
+    for (i = 0; i < nrow; i++, dat += siz)
+    {
+      if (ind[i] == OCI_IND_NULL)
+        SET_STRING_ELT(vec, rows + i, NA_STRING);
+      else
+      {
+        RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+          rodbiTTConvertUCS2UTF8Data(pres, (const ub2 *)dat,
+                                     (size_t)len[i], tempbuf, tempbuflen));
+
+        SET_STRING_ELT(vec, rows + i,
+                       rodbiSCacheMkChar(&res->scache_rodbiRes[cid],
+                                         (char *)*tempbuf, (int)*tempbuflen,
+                                         enc));
+      }
+    }
+    break;
+
+  case FAC_rodbiKern:
+    {
+      int  *dst = INTEGER(vec) + rows;
+
+      for (i = 0; i < nrow; i++, dat += siz)
+        dst[i] = (ind[i] == OCI_IND_NULL) ? NA_INTEGER :
+                 rodbiDictCode(&res->dict_rodbiRes[cid], (char *)dat, len[i]);
+    }
+    break;
+
+  case FUC_rodbiKern:
+    {
+      int  *dst = INTEGER(vec) + rows;
+
+      for (i = 0; i < nrow; i++, dat += siz)
+      {
+        if (ind[i] == OCI_IND_NULL)
+          dst[i] = NA_INTEGER;
+        else
+        {
+          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+            rodbiTTConvertUCS2UTF8Data(pres, (const ub2 *)dat,
+                                       (size_t)len[i], tempbuf, tempbuflen));
+
+          dst[i] = rodbiDictCode(&res->dict_rodbiRes[cid], *tempbuf,
+                                 (int)*tempbuflen);
+        }
+      }
+    }
+    break;
+
+  case BIN_rodbiKern:
+    for (i = 0; i < nrow; i++, dat += siz)
+    {
+      int   rawlen = (ind[i] == OCI_IND_NULL) ? 0 : (int)len[i];
+      SEXP  rawVec;
+
+      PROTECT(rawVec = NEW_RAW(rawlen));
+      if (rawlen)
+        memcpy((void *)RAW(rawVec), (void *)dat, rawlen);
+      SET_VECTOR_ELT(vec, rows + i, rawVec);
+      UNPROTECT(1);
+    }
+    break;
+
+  case DAT_rodbiKern:
+    {
+      double  *dst    = REAL(vec) + rows;
+      boolean  isDate =
+                (pres->typ_roociRes[cid].typ_roociColType == RODBI_DATE);
+
+      for (i = 0; i < nrow; i++, dat += siz)
+      {
+        if (ind[i] == OCI_IND_NULL)
+          dst[i] = NA_REAL;
+        else
+        {
+          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                          roociReadDateTimeData(pres, *(OCIDateTime **)dat,
+                                                &tstm, isDate));
+          dst[i] = tstm;
+        }
+      }
+    }
+    break;
+
+  case DTN_rodbiKern:
+    roociReadDateData(pres, dat, siz, ind, nrow, REAL(vec) + rows);
+    break;
+
+  case DIF_rodbiKern:
+    {
+      double  *dst = REAL(vec) + rows;
+
+      for (i = 0; i < nrow; i++, dat += siz)
+      {
+        if (ind[i] == OCI_IND_NULL)
+          dst[i] = NA_REAL;
+        else
+        {
+          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                          roociReadDiffTimeData(pres, *(OCIInterval **)dat,
+                                                &tstm));
+          dst[i] = tstm;
+        }
+      }
+    }
+    break;
+
+  default:
+    RODBI_FATAL(__func__, 1, res->kern_rodbiRes[cid]);
+    break;
+  }
+} /* end rodbiResAccumKernel */
+
 /* --------------------------- rodbiResAccumInCache ------------------------ */
 
 static void rodbiResAccumInCache(rodbiRes *res)
@@ -4337,16 +7276,18 @@ static void rodbiResAccumInCache(rodbiRes *res)
   {
     ub1  *dat = (ub1 *)(res->res_rodbiRes).dat_roociRes[cid]  +
                        (fbeg * (res->res_rodbiRes).siz_roociRes[cid]);
-    rodbichdl *hdl = (rodbichdl *)0;
+    rodbiArena *arena = &res->arena_rodbiRes[cid];
     ub1        rtyp = RODBI_TYPE_R((res->res_rodbiRes).typ_roociRes[cid].typ_roociColType);
     ub2        etyp = res->res_rodbiRes.typ_roociRes[cid].extyp_roociColType;
 
-    if (res->pghdl_rodbiRes)
+    /* use the kernel selected for this column at define time */
+    if (res->kern_rodbiRes[cid] != GEN_rodbiKern)
     {
-       hdl = &res->pghdl_rodbiRes[cid];
-
-      if (!hdl->begpg_rodbichdl)
-        RODBI_CREATE_COL_HDL(hdl, RODBI_MAX_VAR_PAGE_SIZE);
+      RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                      rodbiResAccumInCacheKernel(res, cid, arena));
+      if (RODBI_ARENA_NOMEM(arena))
+        RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+      continue;
     }
 
     for (fcur = fbeg, lcur = rows; fcur < fend; fcur++, lcur++)
@@ -4357,22 +7298,22 @@ static void rodbiResAccumInCache(rodbiRes *res)
         switch(rtyp)
         {
         case RODBI_R_INT:
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, int, NA_INTEGER);
+          RODBI_ADD_FIXED_DATA_ITEM(arena, int, NA_INTEGER);
           break;
 
         case RODBI_R_LOG:
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, int, NA_LOGICAL);
+          RODBI_ADD_FIXED_DATA_ITEM(arena, int, NA_LOGICAL);
           break;
 
         case RODBI_R_NUM:
         case RODBI_R_DAT:
         case RODBI_R_DIF:
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, double, NA_REAL);
+          RODBI_ADD_FIXED_DATA_ITEM(arena, double, NA_REAL);
           break;
 
         case RODBI_R_CHR:
         case RODBI_R_RAW:
-          RODBI_ADD_VAR_DATA_ITEM(hdl, RODBI_VCOL_FLG_NULL, (void *)0, 0);
+          RODBI_ADD_VAR_DATA_ITEM(arena, (void *)0, RODBI_VCOL_NULL);
           break;
 
         default:
@@ -4385,57 +7326,263 @@ static void rodbiResAccumInCache(rodbiRes *res)
         switch (etyp)
         {
         case SQLT_INT:
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, int, *(int *)dat);
+          RODBI_ADD_FIXED_DATA_ITEM(arena, int, *(int *)dat);
           break;
 
         case SQLT_BDOUBLE:
         case SQLT_FLT:
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, double, *(double *)dat);
+          RODBI_ADD_FIXED_DATA_ITEM(arena, double, *(double *)dat);
           break;
 
         case SQLT_STR:
         case SQLT_BIN:
-          RODBI_ADD_VAR_DATA_ITEM(hdl, RODBI_VCOL_FLG_NOTNULL, (void *)dat,
+          RODBI_ADD_VAR_DATA_ITEM(arena, (void *)dat,
                                   res->res_rodbiRes.len_roociRes[cid][fcur]);
           break;
 
-        case SQLT_CLOB:
-        case SQLT_BLOB:
-        case SQLT_BFILE:
-          RODBI_FATAL(__func__, 2, etyp);
-          break;
+        case SQLT_CLOB:
+        case SQLT_BLOB:
+        case SQLT_BFILE:
+          RODBI_FATAL(__func__, 2, etyp);
+          break;
+
+        case SQLT_TIMESTAMP:
+        case SQLT_TIMESTAMP_LTZ:
+          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+             roociReadDateTimeData(&(res->res_rodbiRes),
+                                   *(OCIDateTime **)dat, &tstm,
+                 (res->res_rodbiRes.typ_roociRes[cid].typ_roociColType == RODBI_DATE) ? 1 : 0));
+          RODBI_ADD_FIXED_DATA_ITEM(arena, double, tstm);
+          break;
+
+        case SQLT_INTERVAL_DS:
+          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+               roociReadDiffTimeData(&(res->res_rodbiRes),
+                                     *(OCIInterval **)dat, &tstm));
+          RODBI_ADD_FIXED_DATA_ITEM(arena, double, tstm);
+          break;
+
+        default:
+          RODBI_FATAL(__func__, 3, etyp);
+          break;
+        }
+      }
+      /* next row */
+      dat += (res->res_rodbiRes).siz_roociRes[cid];
+    }
+
+    if (RODBI_ARENA_NOMEM(arena))
+      RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
+  }
+
+  /* set state */
+  res->rows_rodbiRes  += res->fchEnd_rodbiRes - res->fchBeg_rodbiRes;
+  res->fchBeg_rodbiRes = res->fchEnd_rodbiRes;
+} /* end rodbiResAccumInCache */
+
+/* ----------------------- rodbiResAccumInCacheKernel --------------------- */
+
+static sword rodbiResAccumInCacheKernel(rodbiRes *res, int cid,
+                                        rodbiArena *arena)
+{
+  roociRes   *pres = &(res->res_rodbiRes);
+  int         fbeg = res->fchBeg_rodbiRes;
+  int         nrow = res->fchEnd_rodbiRes - res->fchBeg_rodbiRes;
+  sb4         siz  = pres->siz_roociRes[cid];
+  ub1        *dat  = (ub1 *)pres->dat_roociRes[cid] + (fbeg * siz);
+  sb2        *ind  = pres->ind_roociRes[cid] + fbeg;
+  ub2        *len  = pres->len_roociRes[cid] + fbeg;
+  double      tstm;
+  sword       rc   = OCI_SUCCESS;
+  int         i;
+  int         j;
+
+  switch (res->kern_rodbiRes[cid])
+  {
+  case INT_rodbiKern:
+    {
+      int  *src = (int *)dat;
+
+      /* add each run of non-NULL values in one go */
+      for (i = 0; i < nrow; i = j + 1)
+      {
+        j = rodbiNextNull(ind, i, nrow);
+        if (j > i)
+          RODBI_ADD_FIXED_DATA_ITEMS(arena, int, src + i, j - i);
+        if (j < nrow)
+          RODBI_ADD_FIXED_DATA_ITEM(arena, int, NA_INTEGER);
+      }
+    }
+    break;
+
+  case FLT_rodbiKern:
+    {
+      double *src = (double *)dat;
+
+      /* add each run of non-NULL values in one go */
+      for (i = 0; i < nrow; i = j + 1)
+      {
+        j = rodbiNextNull(ind, i, nrow);
+        if (j > i)
+          RODBI_ADD_FIXED_DATA_ITEMS(arena, double, src + i, j - i);
+        if (j < nrow)
+          RODBI_ADD_FIXED_DATA_ITEM(arena, double, NA_REAL);
+      }
+    }
+    break;
+
+  /* UCS2 data is converted when the cache is populated into R */
+  case STR_rodbiKern:
+  case UCS_rodbiKern:
+  case FAC_rodbiKern:
+  case FUC_rodbiKern:
+  case BIN_rodbiKern:
+    for (i = 0; i < nrow; i++, dat += siz)
+    {
+      if (ind[i] == OCI_IND_NULL)
+        RODBI_ADD_VAR_DATA_ITEM(arena, (void *)0, RODBI_VCOL_NULL);
+      else
+        RODBI_ADD_VAR_DATA_ITEM(arena, (void *)dat,
+                                len[i]);
+    }
+    break;
+
+  case DAT_rodbiKern:
+    {
+      boolean  isDate =
+                (pres->typ_roociRes[cid].typ_roociColType == RODBI_DATE);
+
+      for (i = 0; i < nrow; i++, dat += siz)
+      {
+        if (ind[i] == OCI_IND_NULL)
+          tstm = NA_REAL;
+        else if ((rc = roociReadDateTimeData(pres, *(OCIDateTime **)dat,
+                                             &tstm, isDate)) != OCI_SUCCESS)
+          return rc;
+        RODBI_ADD_FIXED_DATA_ITEM(arena, double, tstm);
+      }
+    }
+    break;
+
+  case DTN_rodbiKern:
+    {
+      double   dates[RODBI_DATE_BATCH];
+      int      cnt;
+
+      for (i = 0; i < nrow; i += cnt)
+      {
+        cnt = ((nrow - i) < RODBI_DATE_BATCH) ? (nrow - i) : RODBI_DATE_BATCH;
+
+        roociReadDateData(pres, dat + (i * siz), siz, ind + i, cnt, dates);
+        RODBI_ADD_FIXED_DATA_ITEMS(arena, double, dates, cnt);
+      }
+    }
+    break;
+
+  case DIF_rodbiKern:
+    for (i = 0; i < nrow; i++, dat += siz)
+    {
+      if (ind[i] == OCI_IND_NULL)
+        tstm = NA_REAL;
+      else if ((rc = roociReadDiffTimeData(pres, *(OCIInterval **)dat,
+                                           &tstm)) != OCI_SUCCESS)
+        return rc;
+      RODBI_ADD_FIXED_DATA_ITEM(arena, double, tstm);
+    }
+    break;
+
+  default:
+    RODBI_FATAL(__func__, 1, res->kern_rodbiRes[cid]);
+    break;
+  }
+
+  return rc;
+} /* end rodbiResAccumInCacheKernel */
+
+
+/* ----------------------------- rodbiNextNull ---------------------------- */
+
+#ifdef RODBI_SIMD_X86
+/* scan 16 indicators at a time */
+__attribute__((target("avx2")))
+static int rodbiNextNullAVX2(const sb2 *ind, int beg, int end)
+{
+  __m256i  nul = _mm256_set1_epi16((short)OCI_IND_NULL);
+  int      cur = beg;
+  int      msk;
+
+  for (; cur + 16 <= end; cur += 16)
+  {
+    msk = _mm256_movemask_epi8(_mm256_cmpeq_epi16(
+                 _mm256_loadu_si256((const __m256i *)(ind + cur)), nul));
+    if (msk)
+      return cur + (__builtin_ctz((unsigned int)msk) >> 1);
+  }
+
+  for (; cur < end; cur++)
+    if (ind[cur] == OCI_IND_NULL)
+      return cur;
+
+  return end;
+}
+
+/* scan 8 indicators at a time */
+static int rodbiNextNullSSE2(const sb2 *ind, int beg, int end)
+{
+  __m128i  nul = _mm_set1_epi16((short)OCI_IND_NULL);
+  int      cur = beg;
+  int      msk;
+
+  for (; cur + 8 <= end; cur += 8)
+  {
+    msk = _mm_movemask_epi8(_mm_cmpeq_epi16(
+                 _mm_loadu_si128((const __m128i *)(ind + cur)), nul));
+    if (msk)
+      return cur + (__builtin_ctz((unsigned int)msk) >> 1);
+  }
+
+  for (; cur < end; cur++)
+    if (ind[cur] == OCI_IND_NULL)
+      return cur;
+
+  return end;
+}
+#else
+static int rodbiNextNullScalar(const sb2 *ind, int beg, int end)
+{
+  int cur;
+
+  for (cur = beg; cur < end; cur++)
+    if (ind[cur] == OCI_IND_NULL)
+      return cur;
 
-        case SQLT_TIMESTAMP:
-        case SQLT_TIMESTAMP_LTZ:
-          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-             roociReadDateTimeData(&(res->res_rodbiRes),
-                                   *(OCIDateTime **)dat, &tstm,
-                 (res->res_rodbiRes.typ_roociRes[cid].typ_roociColType == RODBI_DATE) ? 1 : 0));
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, double, tstm);
-          break;
+  return end;
+}
+#endif /* RODBI_SIMD_X86 */
 
-        case SQLT_INTERVAL_DS:
-          RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-               roociReadDiffTimeData(&(res->res_rodbiRes),
-                                     *(OCIInterval **)dat, &tstm));
-          RODBI_ADD_FIXED_DATA_ITEM(hdl, double, tstm);
-          break;
+/*
+** Returns the position of the first NULL indicator in [beg, end) or end
+** when there is none. The scan is selected once based on the CPU.
+*/
+static int rodbiNextNull(const sb2 *ind, int beg, int end)
+{
+  static int (*scan)(const sb2 *ind, int beg, int end) = NULL;
 
-        default:
-          RODBI_FATAL(__func__, 3, etyp);
-          break;
-        }
-      }
-      /* next row */
-      dat += (res->res_rodbiRes).siz_roociRes[cid];
-    }
+  if (!scan)
+  {
+#ifdef RODBI_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+      scan = rodbiNextNullAVX2;
+    else
+      scan = rodbiNextNullSSE2;
+#else
+    scan = rodbiNextNullScalar;
+#endif
   }
 
-  /* set state */
-  res->rows_rodbiRes  += res->fchEnd_rodbiRes - res->fchBeg_rodbiRes;
-  res->fchBeg_rodbiRes = res->fchEnd_rodbiRes;
-} /* end rodbiResAccumInCache */
-
+  return (*scan)(ind, beg, end);
+} /* end rodbiNextNull */
 
 /* ----------------------------- rodbiResTrim ----------------------------- */
 
@@ -4447,7 +7594,7 @@ static void rodbiResTrim(rodbiRes *res)
   if (res->rows_rodbiRes == res->nrow_rodbiRes)
     return;
 
-  if (!res->pghdl_rodbiRes)
+  if (!res->arena_rodbiRes)
   {
     /* trim column vectors to the actual size */
     for (cid = 0; cid < (res->res_rodbiRes).ncol_roociRes; cid++)
@@ -4466,21 +7613,18 @@ static void rodbiResPopulate(rodbiRes *res)
   SEXP        list = res->list_rodbiRes;
   int         lcur;
   int         cid  = 0;
-  ub1        *conv_buf = (ub1 *)0;
-  int         conv_buf_len = 0;
   char       *tempbuf= (char *)0;
   size_t      tempbuflen = 0;
 
   /* populate data in R from cache */
   for (cid = 0; cid < res->res_rodbiRes.ncol_roociRes; cid++)
   {
-    rodbichdl *hdl  = &res->pghdl_rodbiRes[cid];
-    SEXP       vec  = VECTOR_ELT(list, cid);
-    ub1        rtyp = RODBI_TYPE_R(res->res_rodbiRes.typ_roociRes[cid].typ_roociColType);
-    ub2        etyp = res->res_rodbiRes.typ_roociRes[cid].extyp_roociColType;
-    cetype_t   enc;
-
-    RODBI_REPOSITION_COL_HDL(hdl);
+    rodbiArena *arena = &res->arena_rodbiRes[cid];
+    SEXP        vec   = VECTOR_ELT(list, cid);
+    ub2         etyp  = res->res_rodbiRes.typ_roociRes[cid].extyp_roociColType;
+    boolean     ucs2  = FALSE;
+    boolean     fac   = FALSE;
+    cetype_t    enc;
 
     if (res->res_rodbiRes.form_roociRes[cid] == SQLCS_NCHAR)
     {
@@ -4492,147 +7636,125 @@ static void rodbiResPopulate(rodbiRes *res)
     else
       enc = CE_NATIVE;
 
-    if ((rtyp == RODBI_R_CHR) ||
-        (rtyp == RODBI_R_DAT) ||
-        (rtyp == RODBI_R_RAW))
-    {
-      int tmplen;
-      RODBI_GET_MAX_VAR_ITEM_LEN(hdl, &tmplen);
-
-      if (tmplen > conv_buf_len)
-       {
-         if (conv_buf)
-           ROOCI_MEM_FREE(conv_buf);
+    if ((res->con_rodbiRes->con_rodbiCon.timesten_rociCon) &&
+        (enc == CE_UTF8))
+      ucs2 = TRUE;
 
-         conv_buf_len = tmplen;
-         ROOCI_MEM_MALLOC(conv_buf, conv_buf_len, sizeof(ub1));
-         if (!conv_buf)
-           RODBI_ERROR(RODBI_ERR_MEMORY_ALC);
-       }
-    }
+    if ((res->kern_rodbiRes[cid] == FAC_rodbiKern) ||
+        (res->kern_rodbiRes[cid] == FUC_rodbiKern))
+      fac = TRUE;
 
-    for (lcur = 0; lcur < res->rows_rodbiRes; lcur++)
+    /* copy data */
+    switch (etyp)
     {
-      /* copy data */
-      switch (etyp)
-      {
-        case SQLT_INT:
-          RODBI_GET_FIXED_DATA_ITEM(hdl, int, &(INTEGER(vec)[lcur]), res);
-          break;
+      case SQLT_INT:
+        rodbiArenaCopy(&arena->fix_rodbiArena, (void *)INTEGER(vec));
+        break;
 
-        case SQLT_BDOUBLE:
-        case SQLT_FLT:
-        case SQLT_TIMESTAMP:
-        case SQLT_TIMESTAMP_LTZ:
-        case SQLT_INTERVAL_DS:
-            RODBI_GET_FIXED_DATA_ITEM(hdl, double, &REAL(vec)[lcur], res);
-          break;
+      case SQLT_BDOUBLE:
+      case SQLT_FLT:
+      case SQLT_DAT:
+      case SQLT_TIMESTAMP:
+      case SQLT_TIMESTAMP_LTZ:
+      case SQLT_INTERVAL_DS:
+        rodbiArenaCopy(&arena->fix_rodbiArena, (void *)REAL(vec));
+        break;
 
-        case SQLT_STR:
+      case SQLT_STR:
+      case SQLT_BIN:
+        {
+          rodbiChunk *chk;
+          int        *lens;
+          ub1        *data;
+          int         nlen;
+          int         i;
+
+          arena->var_rodbiArena.cur_rodbiStrm =
+                                          arena->var_rodbiArena.beg_rodbiStrm;
+          arena->var_rodbiArena.off_rodbiStrm = 0;
+
+          lcur = 0;
+          for (chk = arena->fix_rodbiArena.beg_rodbiStrm; chk;
+               chk = chk->next_rodbiChunk)
           {
-            ub1     *data;
-            int      len;
+            lens = (int *)chk->buf_rodbiChunk.dat_rodbiChunk;
+            nlen = (int)(chk->used_rodbiChunk / sizeof(int));
 
-            RODBI_GET_VAR_DATA_ITEM_BY_REF(hdl, (void **)&data, &len, res);
-            if (len == RODBI_VCOL_NULL)
-              SET_STRING_ELT(vec, lcur, NA_STRING);
-            else if (len == RODBI_VCOL_NO_REF)
+            for (i = 0; i < nlen; i++, lcur++)
             {
-              len = RODBI_GET_VAR_DATA_ITEM(hdl,(void *)conv_buf,conv_buf_len);
+              data = rodbiArenaNextVar(&arena->var_rodbiArena, lens[i]);
 
-              if ((res->con_rodbiRes->con_rodbiCon.timesten_rociCon) &&
-                  (enc == CE_UTF8))
+              if (etyp == SQLT_BIN)
               {
-                RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
-                  rodbiTTConvertUCS2UTF8Data(&(res->res_rodbiRes),
-                                             (const ub2 *)conv_buf,
-                                             (size_t)(len), &tempbuf,
-                                             &tempbuflen));
+                SEXP rawVec;
+                int  rawlen = (lens[i] > 0) ? lens[i] : 0;
 
-                SET_STRING_ELT(vec, lcur,
-                             Rf_mkCharLenCE((char *)tempbuf, tempbuflen, enc));
+                PROTECT(rawVec = NEW_RAW(rawlen));
+                if (rawlen)
+                  memcpy((void *)RAW(rawVec), (void *)data, rawlen);
+                SET_VECTOR_ELT(vec, lcur, rawVec);
+                UNPROTECT(1);
               }
-              else
-                SET_STRING_ELT(vec, lcur,
-                               Rf_mkCharLenCE((char *)conv_buf, len, enc));
-            }
-            else
-            {
-              if ((res->con_rodbiRes->con_rodbiCon.timesten_rociCon) &&
-                  (enc == CE_UTF8))
+              else if (fac)
+              {
+                if (lens[i] == RODBI_VCOL_NULL)
+                  INTEGER(vec)[lcur] = NA_INTEGER;
+                else if (ucs2)
+                {
+                  RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
+                    rodbiTTConvertUCS2UTF8Data(&(res->res_rodbiRes),
+                                               (const ub2 *)data,
+                                               (size_t)(lens[i]), &tempbuf,
+                                               &tempbuflen));
+
+                  INTEGER(vec)[lcur] =
+                    rodbiDictCode(&res->dict_rodbiRes[cid], tempbuf,
+                                  (int)tempbuflen);
+                }
+                else
+                  INTEGER(vec)[lcur] =
+                    rodbiDictCode(&res->dict_rodbiRes[cid], (char *)data,
+                                  lens[i]);
+              }
+              else if (lens[i] == RODBI_VCOL_NULL)
+                SET_STRING_ELT(vec, lcur, NA_STRING);
+              else if (ucs2)
               {
                 RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
                   rodbiTTConvertUCS2UTF8Data(&(res->res_rodbiRes),
                                              (const ub2 *)data,
-                                             (size_t)(len), &tempbuf,
+                                             (size_t)(lens[i]), &tempbuf,
                                              &tempbuflen));
 
                 SET_STRING_ELT(vec, lcur,
-                             Rf_mkCharLenCE((char *)tempbuf,tempbuflen,enc));
+                               rodbiSCacheMkChar(&res->scache_rodbiRes[cid],
+                                                 (char *)tempbuf,
+                                                 (int)tempbuflen, enc));
               }
               else
-                SET_STRING_ELT(vec,lcur,Rf_mkCharLenCE((char *)data,len,enc));
-            }
-          }
-          break;
-
-        case SQLT_BIN:
-          {
-            SEXP   rawVec;
-            Rbyte *b;
-            ub1   *data;
-            int    len;
-
-            RODBI_GET_VAR_DATA_ITEM_BY_REF(hdl, (void **)&data, &len, res);
-            if (len == RODBI_VCOL_NULL)
-            {
-              int  len = 0;
-              SEXP rawVec;
-
-              PROTECT(rawVec = NEW_RAW(len));
-              SET_VECTOR_ELT(vec,  lcur, rawVec);
-              UNPROTECT(1);
-            }
-            else if (len == RODBI_VCOL_NO_REF)
-            {
-              len = RODBI_GET_VAR_DATA_ITEM(hdl,(void *)conv_buf,conv_buf_len);
-
-              PROTECT(rawVec = NEW_RAW(len));
-              b = RAW(rawVec);
-              memcpy((void *)b, (void *)conv_buf, len);
-              SET_VECTOR_ELT(vec,  lcur, rawVec);
-              UNPROTECT(1);
-            }
-            else
-            {
-              PROTECT(rawVec = NEW_RAW(len));
-              b = RAW(rawVec);
-              memcpy((void *)b, (void *)data, len);
-              SET_VECTOR_ELT(vec,  lcur, rawVec);
-              UNPROTECT(1);
+                SET_STRING_ELT(vec, lcur,
+                               rodbiSCacheMkChar(&res->scache_rodbiRes[cid],
+                                                 (char *)data, lens[i], enc));
             }
           }
-          break;
+        }
+        break;
 
-        case SQLT_CLOB:
-        case SQLT_BLOB:
-        case SQLT_BFILE:
-          RODBI_FATAL(__func__, 3, etyp);
-          break;
+      case SQLT_CLOB:
+      case SQLT_BLOB:
+      case SQLT_BFILE:
+        RODBI_FATAL(__func__, 3, etyp);
+        break;
 
-        default:
-          RODBI_FATAL(__func__, 4, etyp);
-          break;
-      }
+      default:
+        RODBI_FATAL(__func__, 4, etyp);
+        break;
     }
 
     /* next column */
-    RODBI_DESTROY_COL_HDL(hdl);
+    rodbiArenaFree(arena);
   }
 
-  if (conv_buf)
-    ROOCI_MEM_FREE(conv_buf);
-
   if (tempbuf)
     ROOCI_MEM_FREE(tempbuf);
 
@@ -4647,7 +7769,7 @@ static void rodbiResDataFrame(rodbiRes *res)
   int   ncol = (res->res_rodbiRes).ncol_roociRes;
   int   cid;
 
-  if (res->pghdl_rodbiRes)
+  if (res->arena_rodbiRes)
   {
     /* allocate output data frame */
     rodbiResAlloc(res, res->rows_rodbiRes);
@@ -4656,10 +7778,27 @@ static void rodbiResDataFrame(rodbiRes *res)
     rodbiResPopulate(res);
   }
 
-  /* make datetime columns a POSIXct */
+  /* make factor, datetime and difftime columns */
   for (cid = 0; cid < ncol; cid++)
   {
-    if (RODBI_TYPE_R((res->res_rodbiRes).typ_roociRes[cid].typ_roociColType) == RODBI_R_DAT)
+    if (res->kern_rodbiRes &&
+        ((res->kern_rodbiRes[cid] == FAC_rodbiKern) ||
+         (res->kern_rodbiRes[cid] == FUC_rodbiKern)))
+    {
+      cetype_t enc = CE_NATIVE;
+
+      if ((res->res_rodbiRes.form_roociRes[cid] == SQLCS_NCHAR) &&
+          res->con_rodbiRes->drv_rodbiCon->unicode_as_utf8)
+        enc = CE_UTF8;
+
+      /* levels are in order of first occurrence in this fetch */
+      setAttrib(VECTOR_ELT(res->list_rodbiRes, cid), R_LevelsSymbol,
+                rodbiDictLevels(&res->dict_rodbiRes[cid], enc));
+      setAttrib(VECTOR_ELT(res->list_rodbiRes, cid), R_ClassSymbol,
+                ScalarString(mkChar(RODBI_R_FAC_NM)));
+      rodbiDictFree(&res->dict_rodbiRes[cid]);
+    }
+    else if (RODBI_TYPE_R((res->res_rodbiRes).typ_roociRes[cid].typ_roociColType) == RODBI_R_DAT)
     {
       PROTECT(cla = allocVector(STRSXP, 2)); 
       SET_STRING_ELT(cla, 0, mkChar(RODBI_R_DAT_NM));
@@ -4843,6 +7982,9 @@ static void rodbiPlsqlResPopulate(rodbiRes *res, ub4 *flip)
       /* define data for new cursor statement handle */
       RODBI_CHECK_RES(res, __func__, __LINE__, TRUE,
                       roociResDefine(&res->res_rodbiRes));
+
+      /* select accumulation kernels for new cursor */
+      rodbiResKernel(res);
     }
     else 
     {
@@ -5582,6 +8724,170 @@ static SEXP rodbiResInfoFields(rodbiRes *res)
   return list;
 } /* end rodbiResInfoFields */
 
+/* -------------------------- rodbiResInfoBatch --------------------------- */
+
+static SEXP rodbiResInfoBatch(rodbiRes *res)
+{
+  roociBatchErr  *berr = res->res_rodbiRes.berr_roociRes;
+  SEXP            list;
+  SEXP            names;
+  SEXP            row_names;
+  SEXP            vecRow;
+  SEXP            vecCode;
+  SEXP            vecMsg;
+  int             nerr;
+  int             eid;
+
+  if (!berr)
+    return R_NilValue;
+  nerr = (int)berr->cnt_roociBatchErr;
+
+  /* allocate output list */
+  PROTECT(list = allocVector(VECSXP, 3));
+
+  /* allocate and set names */
+  names = allocVector(STRSXP, 3);
+  setAttrib(list, R_NamesSymbol, names);                  /* protects names */
+
+  /* set class to data frame */
+  setAttrib(list, R_ClassSymbol, mkString("data.frame"));
+
+  /* row of data, code and message of each error */
+  SET_VECTOR_ELT(list,  0, vecRow  = allocVector(INTSXP, nerr));
+  SET_STRING_ELT(names, 0, mkChar("row"));
+
+  SET_VECTOR_ELT(list,  1, vecCode = allocVector(INTSXP, nerr));
+  SET_STRING_ELT(names, 1, mkChar("code"));
+
+  SET_VECTOR_ELT(list,  2, vecMsg  = allocVector(STRSXP, nerr));
+  SET_STRING_ELT(names, 2, mkChar("message"));
+
+  for (eid = 0; eid < nerr; eid++)
+  {
+    INTEGER(vecRow)[eid]  = (int)berr->row_roociBatchErr[eid] + 1;
+    INTEGER(vecCode)[eid] = (int)berr->code_roociBatchErr[eid];
+    SET_STRING_ELT(vecMsg, eid, mkChar(berr->msg_roociBatchErr[eid]));
+  }
+
+  /* allocate and set row names */
+  row_names = allocVector(INTSXP, 2);
+  INTEGER(row_names)[0] = NA_INTEGER;
+  INTEGER(row_names)[1] = -nerr;
+  setAttrib(list, R_RowNamesSymbol, row_names);       /* protects row_names */
+
+  /* release output list */
+  UNPROTECT(1);
+
+  return list;
+} /* end rodbiResInfoBatch */
+
+/* --------------------------- rodbiResAsyncWork -------------------------- */
+
+static void rodbiResAsyncWork(void *ctx)
+{
+  rodbiRes   *res   = (rodbiRes *)ctx;
+  rodbiAsync *async = res->async_rodbiRes;
+  roociCtx   *pctx  = &(res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv);
+  roociRes   *pres  = &(res->res_rodbiRes);
+  sb4         errNum = 0;
+  sword       rc;
+
+  /* execute and define as rociResInit does for a statement without binds */
+  if (res->styp_rodbiRes == OCI_STMT_SELECT)
+  {
+    rc = roociStmtRun(pres, 0, res->styp_rodbiRes, &(res->affrows_rodbiRes));
+    if (rc == OCI_SUCCESS)
+      rc = roociResDefine(pres);
+    if (rc == OCI_SUCCESS)
+    {
+      res->nrows_rodbiRes = pres->nrows_roociRes;
+      rc = rodbiResKernelSel(res);
+    }
+    res->state_rodbiRes = FETCH_rodbiState;
+  }
+  else
+  {
+    rc = roociStmtRun(pres, 1, res->styp_rodbiRes, &(res->affrows_rodbiRes));
+    res->state_rodbiRes = CLOSE_rodbiState;
+  }
+
+  /* the message is taken here, later calls replace the error of a handle */
+  if ((rc == OCI_ERROR) || (rc == OCI_SUCCESS_WITH_INFO))
+    roociGetError(pctx, &async->con_rodbiAsync, __func__, &errNum,
+                  async->msg_rodbiAsync, (ub4)ROOCI_ERR_LEN - 1);
+  else if (rc != OCI_SUCCESS)
+    rodbiCheck(res->con_rodbiRes->drv_rodbiCon, NULL, __func__, __LINE__, rc,
+               async->msg_rodbiAsync, ROOCI_ERR_LEN);
+
+  ROOCI_MUTEX_ACQUIRE(pctx, async->mtx_rodbiAsync);
+  async->rc_rodbiAsync   = rc;
+  async->done_rodbiAsync = TRUE;
+  ROOCI_MUTEX_RELEASE(pctx, async->mtx_rodbiAsync);
+} /* end rodbiResAsyncWork */
+
+/* --------------------------- rodbiResAsyncDone -------------------------- */
+
+static boolean rodbiResAsyncDone(rodbiRes *res)
+{
+  rodbiAsync *async = res->async_rodbiRes;
+  roociCtx   *pctx  = &(res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv);
+  boolean     done;
+
+  if (!async)
+    return TRUE;
+
+  ROOCI_MUTEX_ACQUIRE(pctx, async->mtx_rodbiAsync);
+  done = async->done_rodbiAsync;
+  ROOCI_MUTEX_RELEASE(pctx, async->mtx_rodbiAsync);
+
+  return done;
+} /* end rodbiResAsyncDone */
+
+/* --------------------------- rodbiResAsyncJoin -------------------------- */
+
+static void rodbiResAsyncJoin(rodbiRes *res, boolean cancel)
+{
+  rodbiAsync *async = res->async_rodbiRes;
+  rodbiCon   *con   = res->con_rodbiRes;
+
+  if (!async || !async->thd_rodbiAsync)
+  {
+    (res->res_rodbiRes).con_roociRes = &(con->con_rodbiCon);
+    return;
+  }
+
+  /* a statement still running is broken on the server */
+  if (cancel && !rodbiResAsyncDone(res))
+  {
+    roociThrJoin(&(con->con_rodbiCon), &async->tid_rodbiAsync,
+                 &async->thd_rodbiAsync, TRUE);
+    if (async->rc_rodbiAsync != OCI_SUCCESS)
+      snprintf((char *)async->msg_rodbiAsync, ROOCI_ERR_LEN, "%s",
+               RODBI_ERR_ASYNC_CANCEL);
+  }
+  else
+    roociThrJoin(&(con->con_rodbiCon), &async->tid_rodbiAsync,
+                 &async->thd_rodbiAsync, FALSE);
+
+  /* from here on the result is used on the connection as any other */
+  (res->res_rodbiRes).con_roociRes = &(con->con_rodbiCon);
+} /* end rodbiResAsyncJoin */
+
+/* --------------------------- rodbiResAsyncWait -------------------------- */
+
+static void rodbiResAsyncWait(rodbiRes *res, boolean cancel)
+{
+  rodbiAsync *async = res->async_rodbiRes;
+
+  if (!async)
+    return;
+
+  rodbiResAsyncJoin(res, cancel);
+
+  if (!cancel && (async->rc_rodbiAsync != OCI_SUCCESS))
+    RODBI_ERROR(async->msg_rodbiAsync);
+} /* end rodbiResAsyncWait */
+
 /* -------------------------- rodbiUDTInfoFields -------------------------- */
 
 static SEXP rodbiUDTInfoFields(SEXP list, roociObjType *objtyp,
@@ -5746,29 +9052,61 @@ static void rodbiResTerm(rodbiRes  *res)
   
   con->err_checked_rodbiCon = FALSE;
 
+  /* an asynchronous statement still running is broken */
+  rodbiResAsyncWait(res, TRUE);
+
   /* free result set */
   RODBI_CHECK_RES(res, __func__, __LINE__, FALSE,
                   roociResFree(&(res->res_rodbiRes)));
   (con->con_rodbiCon).num_roociCon--;
 
-  if (res->pghdl_rodbiRes)
+  rodbiResFree(res);
+} /* end rodbiResTerm */
+
+/* ------------------------------- rodbiResFree ---------------------------- */
+
+static void rodbiResFree(rodbiRes  *res)
+{
+  if (res->arena_rodbiRes)
   {
     int        cid;
 
     /* Free any temporary cache memory */
     for (cid = 0; cid < res->res_rodbiRes.ncol_roociRes; cid++)
-    {
-      rodbichdl *hdl  = &res->pghdl_rodbiRes[cid];
-
-      if (hdl->begpg_rodbichdl)
-        RODBI_DESTROY_COL_HDL(hdl);
-    }
+      rodbiArenaFree(&res->arena_rodbiRes[cid]);
     
-    ROOCI_MEM_FREE(res->pghdl_rodbiRes);
+    ROOCI_MEM_FREE(res->arena_rodbiRes);
+  }
+
+  if (res->kern_rodbiRes)
+    ROOCI_MEM_FREE(res->kern_rodbiRes);
+
+  if (res->scache_rodbiRes)
+    ROOCI_MEM_FREE(res->scache_rodbiRes);
+
+  if (res->dict_rodbiRes)
+  {
+    int        cid;
+
+    for (cid = 0; cid < res->res_rodbiRes.ncol_roociRes; cid++)
+      rodbiDictFree(&res->dict_rodbiRes[cid]);
+    ROOCI_MEM_FREE(res->dict_rodbiRes);
+  }
+
+  if (res->async_rodbiRes)
+  {
+    roociCtx  *pctx = &(res->con_rodbiRes->drv_rodbiCon->ctx_rodbiDrv);
+
+    if (res->async_rodbiRes->mtx_rodbiAsync)
+      OCIThreadMutexDestroy(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                            &res->async_rodbiRes->mtx_rodbiAsync);
+    if (res->async_rodbiRes->err_rodbiAsync)
+      OCIHandleFree(res->async_rodbiRes->err_rodbiAsync, OCI_HTYPE_ERROR);
+    ROOCI_MEM_FREE(res->async_rodbiRes);
   }
 
   ROOCI_MEM_FREE(res);
-} /* end rodbiResTerm */
+} /* end rodbiResFree */
   
   
 /* ------------------------------- rodbiCheck ----------------------------- */
@@ -6023,161 +9361,130 @@ ub1 rodbiTypeInt(roociCtx *pctx, ub2 ctyp, sb2 precision, sb1 scale, ub4 size,
 } /* end rodbiTypeInt */
 
 
-static sword RODBI_ADD_VAR_DATA_ITEM(rodbichdl *hdl, ub1 flag,
-                                     void *data, int len)
-{
-  rodbivcol *col;
-  int        tmplen;
-  ub1       *datasrc;
-  ub1       *dat;
+/* ----------------------------- rodbiArenaAdd ---------------------------- */
 
-  /* extend pages if necessary */
-  tmplen = (len + (int)sizeof(rodbivcol));
-  tmplen = (tmplen/(int)(hdl)->pgsize_rodbichdl) + 1;
-  if (hdl->extpgs_rodbichdl <= tmplen)
-    RODBI_EXTEND_PAGES(hdl, hdl->currpg_rodbichdl, tmplen+1);
+static void rodbiArenaAdd(rodbiStrm *strm, const void *data, size_t siz,
+                          int cnt)
+{
+  const ub1  *src = (const ub1 *)data;
+  rodbiChunk *chk = strm->cur_rodbiStrm;
+  rodbiChunk *nchk;
+  size_t      chksz;
+  size_t      fit;
+
+  /* no error is raised here, it may run in a worker thread */
+  if (!siz || strm->nomem_rodbiStrm)
+    return;
 
-  if ((hdl->offset_rodbichdl + (int)sizeof(rodbivcol)) >
-                                                       (hdl)->pgsize_rodbichdl)
+  while (cnt > 0)
   {
-    hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-    hdl->totpgs_rodbichdl++;
-    hdl->extpgs_rodbichdl--;
-    hdl->offset_rodbichdl = 0;
-  }
+    fit = chk ? ((chk->size_rodbiChunk - chk->used_rodbiChunk) / siz) : 0;
 
-  if (len <= hdl->pgsize_rodbichdl)
-  {
-    int remaining = hdl->pgsize_rodbichdl - hdl->offset_rodbichdl -
-                    sizeof(rodbivcol);
-    if (remaining <= 5)
+    /* add a chunk, items are never split across chunks */
+    if (!fit)
     {
-      flag |= RODBI_VCOL_FLG_ELEM_IN_NEXT_PG;
-      flag |= RODBI_VCOL_FLG_ELEM_REF_ACCESS;
+      chksz = chk ? (chk->size_rodbiChunk * 2) : RODBI_MIN_CHUNK_SIZE;
+      if (chksz > RODBI_MAX_CHUNK_SIZE)
+        chksz = RODBI_MAX_CHUNK_SIZE;
+      if (chksz < siz)
+        chksz = siz;
+
+      ROOCI_MEM_MALLOC(nchk,
+                       (offsetof(struct rodbiChunk, buf_rodbiChunk) + chksz),
+                       sizeof(ub1));
+      if (!nchk)
+      {
+        strm->nomem_rodbiStrm = TRUE;
+        return;
+      }
+
+      nchk->next_rodbiChunk = (rodbiChunk *)0;
+      nchk->size_rodbiChunk = chksz;
+      nchk->used_rodbiChunk = 0;
+
+      if (chk)
+        chk->next_rodbiChunk = nchk;
+      else
+        strm->beg_rodbiStrm = nchk;
+      strm->cur_rodbiStrm = chk = nchk;
+      continue;
     }
-    else if(remaining >= len)
-      flag |= RODBI_VCOL_FLG_ELEM_REF_ACCESS;
-  }
 
-  col=(rodbivcol *)&(hdl->currpg_rodbichdl->buf_rodbiPg[hdl->offset_rodbichdl]);
+    if (fit > (size_t)cnt)
+      fit = (size_t)cnt;
 
-  /* Keep data in single page to avoid memcpy during populate */
-  col->len_rodbivcol    = (len);
-  col->flag_rodbivcol   = flag;
-  if (flag & RODBI_VCOL_FLG_ELEM_IN_NEXT_PG)
-  {
-    hdl->totpgs_rodbichdl++;
-    hdl->extpgs_rodbichdl--;
-    hdl->offset_rodbichdl = 0;
-    hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-    dat = (ub1 *)&(hdl->currpg_rodbichdl->buf_rodbiPg[hdl->offset_rodbichdl]);
-  }
-  else
-  {
-    hdl->offset_rodbichdl += offsetof(struct rodbivcol, dat_rodbivcol);
-    dat    = (ub1 *)&col->dat_rodbivcol[0];
+    memcpy(&chk->buf_rodbiChunk.dat_rodbiChunk[chk->used_rodbiChunk], src,
+           fit * siz);
+    chk->used_rodbiChunk += fit * siz;
+    src                  += fit * siz;
+    cnt                  -= (int)fit;
   }
+} /* end rodbiArenaAdd */
 
-  if (flag & RODBI_VCOL_FLG_NULL)
-  {
-    /* align offset to 4 or 8 byte boundary for next item to be added */
-    hdl->offset_rodbichdl += (sizeof(char *) - 
-                              (hdl->offset_rodbichdl % sizeof(char *)));
-    return 0;
-  }
+/* ----------------------------- rodbiArenaCopy --------------------------- */
 
-  hdl->actual_maxlen_rodbichdl = (hdl->actual_maxlen_rodbichdl > len ?
-                                  hdl->actual_maxlen_rodbichdl : len);
-  tmplen = len;
-  datasrc = (ub1 *)data;
-  while (tmplen > 0)
-  {
-    int nbytes = ((hdl)->pgsize_rodbichdl - hdl->offset_rodbichdl) > tmplen ?
-                        tmplen :
-                        ((hdl)->pgsize_rodbichdl - hdl->offset_rodbichdl);
-    memcpy(dat, datasrc, nbytes);
-    tmplen -= nbytes;
-    datasrc += nbytes;
-    if (tmplen)
-    {
-      hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-      hdl->totpgs_rodbichdl++;
-      hdl->extpgs_rodbichdl--;
-      hdl->offset_rodbichdl = 0;
+static void rodbiArenaCopy(rodbiStrm *strm, void *dst)
+{
+  ub1        *out = (ub1 *)dst;
+  rodbiChunk *chk;
 
-      dat = &hdl->currpg_rodbichdl->buf_rodbiPg[0];
-    }
-    else
-      hdl->offset_rodbichdl += nbytes;
+  for (chk = strm->beg_rodbiStrm; chk; chk = chk->next_rodbiChunk)
+  {
+    memcpy(out, chk->buf_rodbiChunk.dat_rodbiChunk, chk->used_rodbiChunk);
+    out += chk->used_rodbiChunk;
   }
+} /* end rodbiArenaCopy */
 
-  /* align offset to 4 or 8 byte boundary for next item to be added */
-  hdl->offset_rodbichdl += (sizeof(char *) - 
-                            (hdl->offset_rodbichdl % sizeof(char *)));
-  return 0;
-} /* RODBI_ADD_VAR_DATA_ITEM */
+/* --------------------------- rodbiArenaNextVar -------------------------- */
 
-static int RODBI_GET_VAR_DATA_ITEM(rodbichdl *hdl, void *data, int len)
+static ub1 *rodbiArenaNextVar(rodbiStrm *strm, int len)
 {
-  rodbivcol *col;
-  int        tmplen;
-  ub1       *dat = (ub1 *)data;
-  ub1       *datsrc;
+  rodbiChunk *chk = strm->cur_rodbiStrm;
+  ub1        *dat;
 
-  if ((hdl->offset_rodbichdl + (int)sizeof(rodbivcol)) >
-                                                       (hdl)->pgsize_rodbichdl)
-  {
-    if (hdl->currpg_rodbichdl->next_rodbiPg)
-      hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-    else
-      return ROOCI_DRV_ERR_NO_DATA;
-    hdl->offset_rodbichdl = 0;
-  }
-  col=(rodbivcol *)&(hdl->currpg_rodbichdl->buf_rodbiPg[hdl->offset_rodbichdl]);
-  tmplen = col->len_rodbivcol;
-  if (col->flag_rodbivcol & RODBI_VCOL_FLG_ELEM_IN_NEXT_PG)
-  {
-    hdl->offset_rodbichdl = 0;
-    hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-    datsrc = (ub1 *)&hdl->currpg_rodbichdl->buf_rodbiPg[hdl->offset_rodbichdl];
-  }
-  else
-  {
-    hdl->offset_rodbichdl += offsetof(struct rodbivcol, dat_rodbivcol);
-    datsrc = &col->dat_rodbivcol[0];
-  }
+  if (len <= 0)
+    return (ub1 *)0;
 
-  if (col->flag_rodbivcol & RODBI_VCOL_FLG_NULL)
+  /* item did not fit in the rest of this chunk when it was added */
+  if ((strm->off_rodbiStrm + (size_t)len) > chk->used_rodbiChunk)
   {
-    /* align offset to 4 or 8 byte boundary to access next item */
-    hdl->offset_rodbichdl += (sizeof(char *) - 
-                              (hdl->offset_rodbichdl % sizeof(char *)));
-    return RODBI_VCOL_NULL;
+    chk                 = chk->next_rodbiChunk;
+    strm->cur_rodbiStrm = chk;
+    strm->off_rodbiStrm = 0;
   }
 
-  while (tmplen > 0)
+  dat                  = &chk->buf_rodbiChunk.dat_rodbiChunk[strm->off_rodbiStrm];
+  strm->off_rodbiStrm += (size_t)len;
+
+  return dat;
+} /* end rodbiArenaNextVar */
+
+/* ----------------------------- rodbiArenaFree --------------------------- */
+
+static void rodbiArenaFree(rodbiArena *arena)
+{
+  rodbiStrm  *strm[2];
+  rodbiChunk *chk;
+  rodbiChunk *nchk;
+  int         i;
+
+  strm[0] = &arena->fix_rodbiArena;
+  strm[1] = &arena->var_rodbiArena;
+
+  for (i = 0; i < 2; i++)
   {
-    int nbytes = ((hdl)->pgsize_rodbichdl - hdl->offset_rodbichdl) > tmplen ?
-                    tmplen : ((hdl)->pgsize_rodbichdl - hdl->offset_rodbichdl);
-    memcpy(dat, datsrc, nbytes);
-    tmplen -= nbytes;
-    dat += nbytes;
-    if (tmplen)
+    for (chk = strm[i]->beg_rodbiStrm; chk; chk = nchk)
     {
-      hdl->currpg_rodbichdl = hdl->currpg_rodbichdl->next_rodbiPg;
-      hdl->offset_rodbichdl = 0;
-      datsrc = &hdl->currpg_rodbichdl->buf_rodbiPg[0];
+      nchk = chk->next_rodbiChunk;
+      ROOCI_MEM_FREE(chk);
     }
-    else
-      hdl->offset_rodbichdl += nbytes;
-  }
 
-  /* align offset to 4 or 8 byte boundary to access next item */
-  hdl->offset_rodbichdl += (sizeof(char *) - 
-                            (hdl->offset_rodbichdl % sizeof(char *)));
-
-  return (col->len_rodbivcol);
-} /* RODBI_GET_VAR_DATA_ITEM */
+    strm[i]->beg_rodbiStrm   = (rodbiChunk *)0;
+    strm[i]->cur_rodbiStrm   = (rodbiChunk *)0;
+    strm[i]->off_rodbiStrm   = 0;
+    strm[i]->nomem_rodbiStrm = FALSE;
+  }
+} /* end rodbiArenaFree */
 
 
 /* end of file rodbi.c */
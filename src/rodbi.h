@@ -21,6 +21,7 @@
    NOTES
 
    MODIFIED   (MM/DD/YY)
+   rpingte     10/17/26 - add factor class name
    rpingte     04/25/25 - version 1.5-1
    rpingte     10/02/24 - do not display flex for now
    rpingte     09/19/24 - improve error reporting
@@ -76,6 +77,7 @@
 #define RODBI_R_DAT_NM       "POSIXct"
 #define RODBI_R_DIF_NM       "difftime"
 #define RODBI_R_RAW_NM       "raw"
+#define RODBI_R_FAC_NM       "factor"
   
 /* rodbi internal Oracle types */
 /* These values are used as index to rodbiIType[] table */
@@ -11,6 +11,31 @@
    NOTES
 
    MODIFIED   (MM/DD/YY)
+   rpingte     10/18/26 - grow batch error arrays with ROOCI_MEM_REALLOC
+   rpingte     10/18/26 - add roociClock
+   rpingte     10/18/26 - share roociStmtExecute in roociStmtExec and
+                          roociStmtRun
+   rpingte     10/18/26 - keep credentials of a connection only when asked
+   rpingte     10/18/26 - add roociStmtRun, roociThrCreate, roociThrJoin and
+                          roociSleep for queries run in worker threads
+   rpingte     10/18/26 - lock connection and result vectors of threaded
+                          contexts
+   rpingte     10/18/26 - set DRCP connection class and purity of sessions
+   rpingte     10/18/26 - add session pool
+   rpingte     10/18/26 - bind a position again only when its buffers change
+   rpingte     10/18/26 - reuse temporary LOBs of binds across chunks
+   rpingte     10/18/26 - write DATE and TIMESTAMP binds in C
+   rpingte     10/18/26 - threaded context and execute on a worker thread
+   rpingte     10/18/26 - execute array DML with OCI_BATCH_ERRORS
+   rpingte     10/18/26 - add direct path load
+   rpingte     10/18/26 - execute bind chunks in an OCI thread
+   rpingte     10/17/26 - bind at a caller supplied buffer
+   rpingte     10/17/26 - prefetch LOBs and read a batch with OCILobArrayRead
+   rpingte     10/17/26 - size fetch array from a byte budget
+   rpingte     10/17/26 - add background fetch pipeline
+   rpingte     10/17/26 - decode DATE and TIMESTAMP(0) in C with a fixed offset
+                          session time zone
+   rpingte     10/17/26 - add roociResDefineAt to fetch into caller buffers
    rpingte     10/17/25 - change __FUNCTION__ to __func__
    rpingte     05/10/25 - add sparse vector support
    rpingte     04/25/25 - Bug 37777349: support data > 32767 in bind to CLOB
@@ -116,6 +141,7 @@
 */
 #ifndef WIN32
 # include <unistd.h>
+# include <time.h>
 #endif
 
 /*---------------------------------------------------------------------------
@@ -125,6 +151,12 @@
 #define ROOCI_CON_DEF            5   /* rooci DEFault number of CONnections */
 #define ROOCI_RES_DEF            5       /* rooci DEFault number of RESults */
 #define ROOCI_LOB_RND         1000                    /* rooci LOB RouNDing */
+#define ROOCI_LOB_PREFETCH   32768       /* LOB data PREFETCHed with a row */
+#define ROOCI_LOB_ARRAY_MAX  (1024 * 1024)    /* largest LOB read in batch */
+#define ROOCI_LOB_BATCH_MAX  (64 * 1024 * 1024)  /* most LOB data in batch */
+
+/* size of each direct path stream buffer */
+#define ROOCI_DIRPATH_BUF    (1024 * 1024)
 
 #define ROOCI_MAJOR_NUMVSN(v)          ((sword)(((v) >> 24) & 0x000000FF))
                                                           /* version number */
@@ -139,19 +171,9 @@
 
 #define ROOCI_TIMESTEN_ID     "TimesTen"       /* TimesTen server id string */
 
-struct roociThrCtx
-{
-  roociCon         *pcon_roociThrCtx;   /* Pointer to the current conection */
-  roociRes         *pres_roociThrCtx;              /* pointer to result set */
-  ub4               nrows_roociThrCtx;
-  sword             rc_roociThrCtx;
-  ub4              *aff_rows_roociThrCtx; /* Number of rows affected by cmd */
-  ub2               styp_roociThrCtx;                     /* Statement type */
-  OCIThreadId      *tid_roociThrCtx;                       /* OCI Thread ID */
-  OCIThreadHandle  *thdhp_roociThrCtx;                     /* thread handle */
-  boolean           bExecOver_roociThrCtx;           /* OCIStmtExecute done */
-};
-typedef struct roociThrCtx roociThrCtx;
+/* number of bytes in the external DATE format */
+/* Julian day number of 1970-01-01 */
+#define ROOCI_EPOCH_JDN    2440588
 
 /* Construct seconds from days, hours, minutes, secs and fractional sec */
 #define ROOCI_SECONDS_FROM_DAYS(seconds_, dy_, hr_, mm_, ss_, fsec_)        \
@@ -187,6 +209,13 @@ do                                                                        \
 while (0)
 
 static sword roociFreeObjs(roociObjType *objtyp);
+static void roociPipeExec(void *ctx);
+static sword roociStmtExecute(roociRes *pres, ub4 noOfRows, ub2 styp,
+                              int *rows_affected, boolean interrupt);
+static sword roociLobAlloc(roociRes *pres, int cid, int nrows);
+static sword roociReadLOBArray(roociRes *pres, ub4 rows);
+static double roociDaysFromCivil(sb4 year, sb4 month, sb4 day);
+static void roociCivilFromDays(double days, sb4 *year, ub1 *month, ub1 *day);
 
 static SEXP roociVecAlloc(roociColType *coltyp, roociObjType *parentobj,
                           int ncol, boolean ora_attributes);
@@ -213,6 +242,7 @@ static sword roociWriteSparseVectorData(roociRes *pres, roociColType *btyp,
 static void roociThrExecCmd(void *pctx)
 {
   roociThrCtx *pthrctx = (roociThrCtx *)pctx;
+  ub4          nerr    = 0;
 
   /* execute statement */
   pthrctx->rc_roociThrCtx = OCIStmtExecute(
@@ -220,9 +250,20 @@ static void roociThrExecCmd(void *pctx)
                                       pthrctx->pres_roociThrCtx->stm_roociRes, 
                                       pthrctx->pcon_roociThrCtx->err_roociCon,
                                       pthrctx->nrows_roociThrCtx, 0, 
-                                      NULL, NULL, OCI_DEFAULT);
+                                      NULL, NULL,
+                                      pthrctx->pres_roociThrCtx->berr_roociRes ?
+                                      OCI_BATCH_ERRORS : OCI_DEFAULT);
   pthrctx->bExecOver_roociThrCtx = TRUE;
 
+  /* rows in error are reported by roociBatchErrGet, the others went in */
+  if (pthrctx->pres_roociThrCtx->berr_roociRes &&
+      (pthrctx->rc_roociThrCtx != OCI_SUCCESS) &&
+      (OCIAttrGet(pthrctx->pres_roociThrCtx->stm_roociRes, OCI_HTYPE_STMT,
+                  &nerr, NULL, OCI_ATTR_NUM_DML_ERRORS,
+                  pthrctx->pcon_roociThrCtx->err_roociCon) == OCI_SUCCESS) &&
+      nerr)
+    pthrctx->rc_roociThrCtx = OCI_SUCCESS;
+
   /* Bug 22233938 */
   if ((pthrctx->rc_roociThrCtx == OCI_ERROR) ||
       (pthrctx->rc_roociThrCtx == OCI_SUCCESS_WITH_INFO))
@@ -306,14 +347,18 @@ static int roociNewConID(roociCtx *pctx)
   roociCon  **conTemp;
   int         conID;
 
-  /* check connection validity */
+  /* check connection validity, called with the connection vector locked */
   for (conID = 0; conID < pctx->max_roociCtx; conID++)
     if (pctx->con_roociCtx[conID] &&
         !rodbiAssertCon((pctx->con_roociCtx[conID])->parent_roociCon, 
                         __func__, 1))
     {   
-      roociTerminateCon(pctx->con_roociCtx[conID], FALSE);
+      roociCon *stale = pctx->con_roociCtx[conID];
+
       pctx->con_roociCtx[conID] = NULL;
+      ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
+      roociTerminateCon(stale, FALSE);
+      ROOCI_MUTEX_ACQUIRE(pctx, pctx->mtx_roociCtx);
     }   
 
   /* find next available connection ID */
@@ -343,18 +388,23 @@ static int roociNewConID(roociCtx *pctx)
 
 static int roociNewResID(roociCon *pcon)
 {
+  roociCtx   *pctx = pcon->ctx_roociCon;
   roociRes  **resTemp;
   int         resID;
 
-  /* check result validity */
+  /* check result validity, called with the result vector locked */
   for (resID = 0; resID < pcon->max_roociCon; resID++)
   {
     if (pcon->res_roociCon[resID] &&
         !rodbiAssertRes((pcon->res_roociCon[resID])->parent_roociRes,
                          __func__, 1))
     { 
-      roociResFree(pcon->res_roociCon[resID]);
+      roociRes *stale = pcon->res_roociCon[resID];
+
       pcon->res_roociCon[resID] = NULL;
+      ROOCI_MUTEX_RELEASE(pctx, pcon->mtx_roociCon);
+      roociResFree(stale);
+      ROOCI_MUTEX_ACQUIRE(pctx, pcon->mtx_roociCon);
     }
   }
 
@@ -383,7 +433,8 @@ static int roociNewResID(roociCon *pcon)
 /* ----------------------------- roociInitializeCtx ----------------------- */
 
 sword roociInitializeCtx (roociCtx *pctx, void *epx, boolean interrupt_srv,
-                          boolean unicode_as_utf8, boolean ora_objects)
+                          boolean unicode_as_utf8, boolean ora_objects,
+                          boolean threaded)
 {
   sword    rc = OCI_ERROR;
   ub4      mode = OCI_DEFAULT;
@@ -402,6 +453,10 @@ sword roociInitializeCtx (roociCtx *pctx, void *epx, boolean interrupt_srv,
     if (ora_objects)
       mode |= OCI_OBJECT;
 
+    /* sessions of this context are used by several threads at once */
+    if (threaded)
+      mode |= OCI_THREADED;
+
     if (unicode_as_utf8)
     {
       rc = OCINlsEnvironmentVariableGet((void *)&csid, sizeof(csid),
@@ -448,6 +503,22 @@ sword roociInitializeCtx (roociCtx *pctx, void *epx, boolean interrupt_srv,
       pctx->max_roociCtx       = ROOCI_CON_DEF;
       pctx->control_c_roociCtx = interrupt_srv;
     }
+
+    /* threads may open and close connections and results at once */
+    if (threaded && !epx)
+    {
+      void *temp = NULL;
+
+      pctx->threaded_roociCtx = TRUE;
+      rc = OCIHandleAlloc(pctx->env_roociCtx, (void **)&temp,
+                          OCI_HTYPE_ERROR, (size_t)0, (void **)NULL);
+      if (rc != OCI_SUCCESS)
+        return rc;
+      pctx->lerr_roociCtx = temp;
+
+      rc = OCIThreadMutexInit(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                              &pctx->mtx_roociCtx);
+    }
   }
 
   return rc;
@@ -457,7 +528,9 @@ sword roociInitializeCtx (roociCtx *pctx, void *epx, boolean interrupt_srv,
 
 sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
                          char *user, char *pass, char *cstr,
-                         ub4 stmt_cache_siz, ub4 session_mode)
+                         ub4 stmt_cache_siz, ub4 session_mode,
+                         char *cclass, ub4 purity, roociPool *ppool,
+                         boolean keep_auth)
 {
   sword     rc                             = OCI_ERROR; 
   int       conid;
@@ -468,13 +541,6 @@ sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
   /* update driver reference in connection context */
   pcon->ctx_roociCon = pctx;
 
-  /* get connection ID */
-  conid = roociNewConID(pctx);
-  if (conid == ROOCI_DRV_ERR_MEM_FAIL)
-    return ROOCI_DRV_ERR_MEM_FAIL;
-  else
-    pcon->conID_roociCon = conid;
-
   /* set error handle */
   if (pctx->extproc_roociCtx)
     pcon->err_roociCon = pctx->err_roociCtx;
@@ -488,6 +554,15 @@ sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
     pcon->err_roociCon  = temp;
   }
 
+  /* results of the connection may be opened by another thread */
+  if (pctx->mtx_roociCtx)
+  {
+    rc = OCIThreadMutexInit(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                            &pcon->mtx_roociCon);
+    if (rc != OCI_SUCCESS)
+      return rc;
+  }
+
   /* set service context handle */
   if (pctx->extproc_roociCtx)
     pcon->svc_roociCon = pctx->svc_roociCtx;
@@ -501,18 +576,22 @@ sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
       return ROOCI_DRV_ERR_CON_FAIL;
     pcon->auth_roociCon = temp;
 
-    /* set username */
-    rc = OCIAttrSet((void *)(pcon->auth_roociCon), OCI_HTYPE_AUTHINFO,
-                    (void *)user, strlen(user), OCI_ATTR_USERNAME, 
-                    pcon->err_roociCon);
-    if (rc == OCI_ERROR)
-      return ROOCI_DRV_ERR_CON_FAIL;
+    /* sessions of a pool are logged on by the pool */
+    if (!ppool)
+    {
+      /* set username */
+      rc = OCIAttrSet((void *)(pcon->auth_roociCon), OCI_HTYPE_AUTHINFO,
+                      (void *)user, strlen(user), OCI_ATTR_USERNAME, 
+                      pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return ROOCI_DRV_ERR_CON_FAIL;
 
-    /* set password */
-    rc = OCIAttrSet(pcon->auth_roociCon, OCI_HTYPE_AUTHINFO, (void *)pass, 
-                    strlen(pass), OCI_ATTR_PASSWORD, pcon->err_roociCon);
-    if (rc == OCI_ERROR)
-      return ROOCI_DRV_ERR_CON_FAIL;
+      /* set password */
+      rc = OCIAttrSet(pcon->auth_roociCon, OCI_HTYPE_AUTHINFO, (void *)pass, 
+                      strlen(pass), OCI_ATTR_PASSWORD, pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return ROOCI_DRV_ERR_CON_FAIL;
+    }
 
 #if OCI_MAJOR_VERSION > 10
     /* set driver name */
@@ -521,15 +600,66 @@ sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
                     OCI_ATTR_DRIVER_NAME, pcon->err_roociCon);
     if (rc == OCI_ERROR)
       return ROOCI_DRV_ERR_CON_FAIL;
+
+    /* sessions of the same class share pooled servers of DRCP */
+    if (cclass && *cclass)
+    {
+      rc = OCIAttrSet(pcon->auth_roociCon, OCI_HTYPE_AUTHINFO,
+                      (void *)cclass, strlen(cclass),
+                      OCI_ATTR_CONNECTION_CLASS, pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return ROOCI_DRV_ERR_CON_FAIL;
+
+      ROOCI_MEM_ALLOC(pcon->cclass_roociCon, (strlen(cclass) + 1),
+                      sizeof(char));
+      if (!pcon->cclass_roociCon)
+        return ROOCI_DRV_ERR_MEM_FAIL;
+      memcpy(pcon->cclass_roociCon, cclass, strlen(cclass));
+    }
+
+    /* reuse a session left by another process or always a new one */
+    if (purity != OCI_ATTR_PURITY_DEFAULT)
+    {
+      rc = OCIAttrSet(pcon->auth_roociCon, OCI_HTYPE_AUTHINFO,
+                      (void *)&purity, sizeof(purity), OCI_ATTR_PURITY,
+                      pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return ROOCI_DRV_ERR_CON_FAIL;
+    }
+    pcon->purity_roociCon = purity;
 #endif
 
-    /* start user session */
-    rc = OCISessionGet(pctx->env_roociCtx, pcon->err_roociCon, 
-                       &pcon->svc_roociCon, pcon->auth_roociCon, 
-                       (OraText *)cstr, strlen(cstr), 
-                       NULL, 0, NULL, NULL, NULL, session_mode);
+    /* start user session, or take an idle one of the pool */
+    if (ppool)
+      rc = OCISessionGet(pctx->env_roociCtx, pcon->err_roociCon, 
+                         &pcon->svc_roociCon, pcon->auth_roociCon, 
+                         ppool->name_roociPool, ppool->namsz_roociPool,
+                         NULL, 0, NULL, NULL, NULL,
+                         session_mode | OCI_SESSGET_SPOOL);
+    else
+      rc = OCISessionGet(pctx->env_roociCtx, pcon->err_roociCon, 
+                         &pcon->svc_roociCon, pcon->auth_roociCon, 
+                         (OraText *)cstr, strlen(cstr), 
+                         NULL, 0, NULL, NULL, NULL, session_mode);
     if (rc == OCI_ERROR)
     return ROOCI_DRV_ERR_CON_FAIL;
+
+    if (ppool)
+    {
+      pcon->pool_roociCon = ppool;
+      ppool->ncon_roociPool++;
+    }
+    else if (keep_auth)
+    {
+      /* keep credentials to open more sessions of this user */
+      ROOCI_MEM_ALLOC(pcon->user_roociCon, (strlen(user) + 1), sizeof(char));
+      ROOCI_MEM_ALLOC(pcon->pass_roociCon, (strlen(pass) + 1), sizeof(char));
+      if (!pcon->user_roociCon || !pcon->pass_roociCon)
+        return ROOCI_DRV_ERR_MEM_FAIL;
+      memcpy(pcon->user_roociCon, user, strlen(user));
+      memcpy(pcon->pass_roociCon, pass, strlen(pass));
+    }
+    pcon->mode_roociCon = session_mode;
   }
 
   /* TimesTen IMDB or Oracle RDBMS connection? */
@@ -576,19 +706,210 @@ sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
   if (rc == OCI_ERROR)
     return ROOCI_DRV_ERR_CON_FAIL;
 
-  /* add to the connections vector */
+  pcon->max_roociCon = ROOCI_RES_DEF; 
+
+  /* get connection ID and add to the connections vector */
+  ROOCI_MUTEX_ACQUIRE(pctx, pctx->mtx_roociCtx);
+  conid = roociNewConID(pctx);
+  if (conid == ROOCI_DRV_ERR_MEM_FAIL)
+  {
+    ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+  pcon->conID_roociCon = conid;
   pctx->con_roociCtx[pcon->conID_roociCon] = pcon;
 
   /* bump up the number of open/total connections */
   pctx->num_roociCtx++;
   pctx->tot_roociCtx++;
 
-  pcon->max_roociCon = ROOCI_RES_DEF; 
   pctx->acc_roociCtx.conID_roociConAccess = ROOCI_RES_DEF;
+  ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
 
   return rc;
 } /* end of roociInitializeCon */
 
+/* ----------------------------- roociInitializePool ---------------------- */
+
+sword roociInitializePool(roociCtx *pctx, roociPool *ppool,
+                          char *user, char *pass, char *cstr,
+                          ub4 min, ub4 max, ub4 incr, ub4 stmt_cache_siz)
+{
+  sword     rc   = OCI_ERROR;
+  ub4       mode = OCI_SPC_HOMOGENEOUS;
+  boolean   ext  = (!strlen(user) && !strlen(pass));
+                                    /* wallet or external authentication */
+  void     *temp = NULL;
+                              /* pointer to remove strict-aliasing warnings */
+
+  ppool->ctx_roociPool    = pctx;
+  ppool->min_roociPool    = min;
+  ppool->max_roociPool    = max;
+  ppool->incr_roociPool   = incr;
+  ppool->scache_roociPool = stmt_cache_siz;
+
+  /* allocate error handle */
+  rc = OCIHandleAlloc(pctx->env_roociCtx, (void **)&temp,
+                      OCI_HTYPE_ERROR, (size_t)0, (void **)NULL);
+  if (rc == OCI_ERROR)
+    return rc;
+  ppool->err_roociPool = temp;
+
+  /* allocate session pool handle */
+  temp = NULL;
+  rc = OCIHandleAlloc(pctx->env_roociCtx, (void **)&temp,
+                      OCI_HTYPE_SPOOL, (size_t)0, (void **)NULL);
+  if (rc == OCI_ERROR)
+    return rc;
+  ppool->spool_roociPool = temp;
+
+#if OCI_MAJOR_VERSION > 10
+  /* set driver name of the sessions the pool opens */
+  temp = NULL;
+  rc = OCIHandleAlloc(pctx->env_roociCtx, (void **)&temp,
+                      OCI_HTYPE_AUTHINFO, (size_t)0, (void **)NULL);
+  if (rc == OCI_ERROR)
+    return rc;
+  ppool->auth_roociPool = temp;
+
+  rc = OCIAttrSet(ppool->auth_roociPool, OCI_HTYPE_AUTHINFO,
+                  (void *)"ROracle", sizeof("ROracle") - 1,
+                  OCI_ATTR_DRIVER_NAME, ppool->err_roociPool);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  rc = OCIAttrSet(ppool->spool_roociPool, OCI_HTYPE_SPOOL,
+                  ppool->auth_roociPool, 0, OCI_ATTR_SPOOL_AUTH,
+                  ppool->err_roociPool);
+  if (rc == OCI_ERROR)
+    return rc;
+#endif
+
+  /* sessions keep their cached statements when returned to the pool */
+  if (stmt_cache_siz)
+  {
+    mode |= OCI_SPC_STMTCACHE;
+    rc = OCIAttrSet(ppool->spool_roociPool, OCI_HTYPE_SPOOL,
+                    (void *)&stmt_cache_siz, 0, OCI_ATTR_SPOOL_STMTCACHESIZE,
+                    ppool->err_roociPool);
+    if (rc == OCI_ERROR)
+      return rc;
+  }
+
+  /* log on the minimum number of sessions */
+  rc = OCISessionPoolCreate(pctx->env_roociCtx, ppool->err_roociPool,
+                            ppool->spool_roociPool, &ppool->name_roociPool,
+                            &ppool->namsz_roociPool,
+                            (const OraText *)cstr, strlen(cstr),
+                            min, max, incr,
+                            ext ? NULL : (OraText *)user,
+                            ext ? 0 : strlen(user),
+                            ext ? NULL : (OraText *)pass,
+                            ext ? 0 : strlen(pass), mode);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  /* set connection string */
+  ROOCI_MEM_ALLOC(ppool->cstr_roociPool, (strlen(cstr) + 1), sizeof(char));
+  if (!(ppool->cstr_roociPool))
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  memcpy(ppool->cstr_roociPool, cstr, strlen(cstr));
+
+  /* add to the pools of the driver */
+  ppool->next_roociPool = pctx->pool_roociCtx;
+  pctx->pool_roociCtx   = ppool;
+
+  return rc;
+} /* end of roociInitializePool */
+
+/* ----------------------------- roociGetPoolInfo ------------------------- */
+
+sword roociGetPoolInfo(roociPool *ppool, ub4 *open, ub4 *busy)
+{
+  sword rc;
+
+  rc = OCIAttrGet(ppool->spool_roociPool, OCI_HTYPE_SPOOL, (void *)open,
+                  NULL, OCI_ATTR_SPOOL_OPEN_COUNT, ppool->err_roociPool);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  rc = OCIAttrGet(ppool->spool_roociPool, OCI_HTYPE_SPOOL, (void *)busy,
+                  NULL, OCI_ATTR_SPOOL_BUSY_COUNT, ppool->err_roociPool);
+  return rc;
+} /* end of roociGetPoolInfo */
+
+/* ----------------------------- roociGetPoolError ------------------------ */
+
+sword roociGetPoolError(roociPool *ppool, sb4 *errNum, text *errMsg,
+                        ub4 errMsgSize)
+{
+  sword rc = OCI_ERROR;
+
+  if (ppool->err_roociPool)
+    rc = OCIErrorGet(ppool->err_roociPool, 1, (text *)NULL, errNum,
+                     errMsg, errMsgSize, (ub4)OCI_HTYPE_ERROR);
+  else if (ppool->ctx_roociPool && ppool->ctx_roociPool->env_roociCtx)
+    rc = OCIErrorGet(ppool->ctx_roociPool->env_roociCtx, 1, (text *)NULL,
+                     errNum, errMsg, errMsgSize, (ub4)OCI_HTYPE_ENV);
+
+  return rc;
+} /* end of roociGetPoolError */
+
+/* ----------------------------- roociTerminatePool ----------------------- */
+
+sword roociTerminatePool(roociPool *ppool)
+{
+  sword       rc   = OCI_SUCCESS;
+  roociPool **link;
+
+  /* remove from the pools of the driver */
+  if (ppool->ctx_roociPool)
+  {
+    for (link = &ppool->ctx_roociPool->pool_roociCtx; *link;
+         link = &(*link)->next_roociPool)
+      if (*link == ppool)
+      {
+        *link = ppool->next_roociPool;
+        break;
+      }
+  }
+
+  /* log off the sessions, connections were released to the pool */
+  if (ppool->name_roociPool)
+  {
+    rc = OCISessionPoolDestroy(ppool->spool_roociPool, ppool->err_roociPool,
+                               OCI_DEFAULT);
+    if (rc == OCI_ERROR)
+      return rc;
+    ppool->name_roociPool = NULL;
+  }
+
+  if (ppool->cstr_roociPool)
+  {
+    ROOCI_MEM_FREE(ppool->cstr_roociPool);
+  }
+
+  if (ppool->spool_roociPool)
+  {
+    OCIHandleFree(ppool->spool_roociPool, OCI_HTYPE_SPOOL);
+    ppool->spool_roociPool = NULL;
+  }
+
+  if (ppool->auth_roociPool)
+  {
+    OCIHandleFree(ppool->auth_roociPool, OCI_HTYPE_AUTHINFO);
+    ppool->auth_roociPool = NULL;
+  }
+
+  if (ppool->err_roociPool)
+  {
+    OCIHandleFree(ppool->err_roociPool, OCI_HTYPE_ERROR);
+    ppool->err_roociPool = NULL;
+  }
+
+  return rc;
+} /* end of roociTerminatePool */
+
 /*----------------------------roociGetError-------------------------------- */
 
 sword roociGetError(roociCtx *pctx, roociCon *pcon, const char *msgText,
@@ -777,13 +1098,7 @@ sword roociInitializeRes(roociCon *pcon, roociRes *pres, text *qry, int qrylen,
                          int rows_per_fetch, int rows_per_write)
 {
   sword rc = OCI_ERROR;
-
-  /* get result ID */
-  rc = roociNewResID(pcon);
-  if (pres->resID_roociRes == ROOCI_DRV_ERR_MEM_FAIL)
-    return ROOCI_DRV_ERR_MEM_FAIL;
-  else
-    pres->resID_roociRes = rc;
+  int   resid;
 
   pres->prefetch_roociRes    = prefetch;
   pres->nrows_roociRes       = rows_per_fetch;
@@ -886,7 +1201,20 @@ sword roociInitializeRes(roociCon *pcon, roociRes *pres, text *qry, int qrylen,
     return rc;
   }
 
+  /* get result ID and add to the results vector */
+  ROOCI_MUTEX_ACQUIRE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+  resid = roociNewResID(pcon);
+  if (resid == ROOCI_DRV_ERR_MEM_FAIL)
+  {
+    ROOCI_MUTEX_RELEASE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+    OCIStmtRelease(pres->stm_roociRes, pcon->err_roociCon,
+                   (OraText *)NULL, 0, OCI_DEFAULT);
+    pres->stm_roociRes = NULL;
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+  pres->resID_roociRes = resid;
   pcon->res_roociCon[pres->resID_roociRes] = pres;
+  ROOCI_MUTEX_RELEASE(pcon->ctx_roociCon, pcon->mtx_roociCon);
 
   /* update connection reference in result context */
   pres->con_roociRes = pcon;
@@ -951,6 +1279,16 @@ sword roociTerminateCtx(roociCtx *pctx)
     ROOCI_MEM_FREE(pctx->con_roociCtx);
   }
 
+  /* free mutex of connection vector */
+  if (pctx->mtx_roociCtx)
+    OCIThreadMutexDestroy(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                          &pctx->mtx_roociCtx);
+  if (pctx->lerr_roociCtx)
+  {
+    OCIHandleFree(pctx->lerr_roociCtx, OCI_HTYPE_ERROR);
+    pctx->lerr_roociCtx = NULL;
+  }
+
   /* free environment handle */
   if (pctx->env_roociCtx && !pctx->extproc_roociCtx)
     rc = OCIHandleFree(pctx->env_roociCtx, OCI_HTYPE_ENV);
@@ -971,6 +1309,23 @@ sword roociTerminateCon(roociCon *pcon, boolean validCon)
   {
     ROOCI_MEM_FREE(pcon->cstr_roociCon);
   }
+
+  /* free credentials, password cleared first */
+  if (pcon->user_roociCon)
+  {
+    ROOCI_MEM_FREE(pcon->user_roociCon);
+  }
+  if (pcon->pass_roociCon)
+  {
+    memset(pcon->pass_roociCon, 0, strlen(pcon->pass_roociCon));
+    ROOCI_MEM_FREE(pcon->pass_roociCon);
+  }
+
+  /* free connection class */
+  if (pcon->cclass_roociCon)
+  {
+    ROOCI_MEM_FREE(pcon->cclass_roociCon);
+  }
     
   /* clean up results */
   if (pcon->res_roociCon)
@@ -993,9 +1348,17 @@ sword roociTerminateCon(roociCon *pcon, boolean validCon)
   if (pcon->svc_roociCon && !pctx->extproc_roociCtx)
   {
     rc = OCISessionRelease(pcon->svc_roociCon, pcon->err_roociCon, NULL, 
-                           0, OCI_DEFAULT);
+                           0, pcon->rlsmode_roociCon);
     if (rc == OCI_ERROR)
       return rc;
+    pcon->svc_roociCon = NULL;
+
+    /* the session stays open in its pool */
+    if (pcon->pool_roociCon)
+    {
+      pcon->pool_roociCon->ncon_roociPool--;
+      pcon->pool_roociCon = NULL;
+    }
   }
 
   /* free authentication handle */    
@@ -1014,10 +1377,20 @@ sword roociTerminateCon(roociCon *pcon, boolean validCon)
       return rc;
   }
   
-  pctx->con_roociCtx[pcon->conID_roociCon] = NULL;
-    
-  if (validCon == TRUE)
-    pctx->num_roociCtx--;
+  /* a connection that failed to open was never added */
+  ROOCI_MUTEX_ACQUIRE(pctx, pctx->mtx_roociCtx);
+  if (pctx->con_roociCtx &&
+      pctx->con_roociCtx[pcon->conID_roociCon] == pcon)
+  {
+    pctx->con_roociCtx[pcon->conID_roociCon] = NULL;
+    if (validCon == TRUE)
+      pctx->num_roociCtx--;
+  }
+  ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
+
+  if (pcon->mtx_roociCon)
+    OCIThreadMutexDestroy(pctx->env_roociCtx, pctx->lerr_roociCtx,
+                          &pcon->mtx_roociCon);
 
   return rc;
 } /* end of roociTerminateCon */
@@ -1041,9 +1414,194 @@ sword roociRollbackCon(roociCon *pcon)
   return rc;
 } /* end of roociRollbackCon */
 
+/* -------------------------- roociDirPathInit ---------------------------- */
+
+sword roociDirPathInit(roociCon *pcon, roociDirPath *pdp, const char *schema,
+                       const char *table, ub2 ncol, const char **names,
+                       const ub2 *types, const ub4 *sizes, const ub2 *csids,
+                       ub4 nrows)
+{
+  OCIEnv     *envh  = pcon->ctx_roociCon->env_roociCtx;
+  OCIError   *errh  = pcon->err_roociCon;
+  OCIParam   *collst = NULL;
+  OCIParam   *col;
+  ub4         bufsz = ROOCI_DIRPATH_BUF;
+  ub2         cid;
+  sword       rc;
+
+  rc = OCIHandleAlloc(envh, (void **)&pdp->ctx_roociDirPath,
+                      OCI_HTYPE_DIRPATH_CTX, 0, NULL);
+  if (rc != OCI_SUCCESS)
+    return rc;
+  pdp->ncol_roociDirPath = ncol;
+
+  /* table, column count and size of stream buffers and column array */
+  if (schema &&
+      ((rc = OCIAttrSet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        (void *)schema, (ub4)strlen(schema),
+                        OCI_ATTR_SCHEMA_NAME, errh)) != OCI_SUCCESS))
+    return rc;
+
+  if (((rc = OCIAttrSet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        (void *)table, (ub4)strlen(table), OCI_ATTR_NAME,
+                        errh)) != OCI_SUCCESS) ||
+      ((rc = OCIAttrSet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        &ncol, (ub4)0, OCI_ATTR_NUM_COLS,
+                        errh)) != OCI_SUCCESS) ||
+      ((rc = OCIAttrSet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        &nrows, (ub4)0, OCI_ATTR_NUM_ROWS,
+                        errh)) != OCI_SUCCESS) ||
+      ((rc = OCIAttrSet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        &bufsz, (ub4)0, OCI_ATTR_BUF_SIZE,
+                        errh)) != OCI_SUCCESS) ||
+      ((rc = OCIAttrGet(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX,
+                        &collst, NULL, OCI_ATTR_LIST_COLUMNS,
+                        errh)) != OCI_SUCCESS))
+    return rc;
+
+  /* describe each column as it is laid out in the R vectors */
+  for (cid = 0; cid < ncol; cid++)
+  {
+    rc = OCIParamGet(collst, OCI_DTYPE_PARAM, errh, (void **)&col,
+                     (ub4)(cid + 1));
+    if (rc != OCI_SUCCESS)
+      return rc;
+
+    if (((rc = OCIAttrSet(col, OCI_DTYPE_PARAM, (void *)names[cid],
+                          (ub4)strlen(names[cid]), OCI_ATTR_NAME,
+                          errh)) == OCI_SUCCESS) &&
+        ((rc = OCIAttrSet(col, OCI_DTYPE_PARAM, (void *)&types[cid], (ub4)0,
+                          OCI_ATTR_DATA_TYPE, errh)) == OCI_SUCCESS) &&
+        ((rc = OCIAttrSet(col, OCI_DTYPE_PARAM, (void *)&sizes[cid], (ub4)0,
+                          OCI_ATTR_DATA_SIZE, errh)) == OCI_SUCCESS) &&
+        csids[cid])
+      rc = OCIAttrSet(col, OCI_DTYPE_PARAM, (void *)&csids[cid], (ub4)0,
+                      OCI_ATTR_CHARSET_ID, errh);
+
+    OCIDescriptorFree(col, OCI_DTYPE_PARAM);
+    if (rc != OCI_SUCCESS)
+      return rc;
+  }
+
+  rc = OCIDirPathPrepare(pdp->ctx_roociDirPath, pcon->svc_roociCon, errh);
+  if (rc != OCI_SUCCESS)
+    return rc;
+
+  if (((rc = OCIHandleAlloc(pdp->ctx_roociDirPath,
+                            (void **)&pdp->ca_roociDirPath,
+                            OCI_HTYPE_DIRPATH_COLUMN_ARRAY, 0,
+                            NULL)) != OCI_SUCCESS) ||
+      ((rc = OCIHandleAlloc(pdp->ctx_roociDirPath,
+                            (void **)&pdp->str_roociDirPath,
+                            OCI_HTYPE_DIRPATH_STREAM, 0,
+                            NULL)) != OCI_SUCCESS))
+    return rc;
+
+  /* rows the column array really has */
+  return OCIAttrGet(pdp->ca_roociDirPath, OCI_HTYPE_DIRPATH_COLUMN_ARRAY,
+                    &pdp->nrows_roociDirPath, NULL, OCI_ATTR_NUM_ROWS, errh);
+} /* end of roociDirPathInit */
+
+/* -------------------------- roociDirPathSet ----------------------------- */
+
+sword roociDirPathSet(roociCon *pcon, roociDirPath *pdp, ub4 row, ub2 col,
+                      ub1 *dat, ub4 len, ub1 flg)
+{
+  return OCIDirPathColArrayEntrySet(pdp->ca_roociDirPath, pcon->err_roociCon,
+                                    row, col, dat, len, flg);
+} /* end of roociDirPathSet */
+
+/* -------------------------- roociDirPathLoad ---------------------------- */
+
+sword roociDirPathLoad(roociCon *pcon, roociDirPath *pdp, ub4 rows,
+                       ub4 *done)
+{
+  OCIError   *errh = pcon->err_roociCon;
+  ub4         off  = 0;
+  ub4         cnt;
+  boolean     more;
+  sword       rc;
+
+  *done = 0;
+  do
+  {
+    /* a full stream is loaded and conversion goes on from the next row */
+    rc = OCIDirPathColArrayToStream(pdp->ca_roociDirPath,
+                                    pdp->ctx_roociDirPath,
+                                    pdp->str_roociDirPath, errh, rows, off);
+    if ((rc != OCI_SUCCESS) && (rc != OCI_CONTINUE))
+      return rc;
+
+    more = (rc == OCI_CONTINUE);
+    if (more &&
+        ((rc = OCIAttrGet(pdp->ca_roociDirPath,
+                          OCI_HTYPE_DIRPATH_COLUMN_ARRAY, &cnt, NULL,
+                          OCI_ATTR_ROW_COUNT, errh)) != OCI_SUCCESS))
+      return rc;
+
+    if (((rc = OCIDirPathLoadStream(pdp->ctx_roociDirPath,
+                                    pdp->str_roociDirPath,
+                                    errh)) != OCI_SUCCESS) ||
+        ((rc = OCIDirPathStreamReset(pdp->str_roociDirPath,
+                                     errh)) != OCI_SUCCESS))
+      return rc;
+
+    if (more)
+    {
+      off  += cnt;
+      *done = off;
+    }
+  } while (more);
+
+  *done = rows;
+  return OCIDirPathColArrayReset(pdp->ca_roociDirPath, errh);
+} /* end of roociDirPathLoad */
+
+/* -------------------------- roociDirPathFinish -------------------------- */
+
+sword roociDirPathFinish(roociCon *pcon, roociDirPath *pdp)
+{
+  return OCIDirPathFinish(pdp->ctx_roociDirPath, pcon->err_roociCon);
+} /* end of roociDirPathFinish */
+
+/* -------------------------- roociDirPathFree ---------------------------- */
+
+void roociDirPathFree(roociCon *pcon, roociDirPath *pdp, boolean abort)
+{
+  if (abort && pdp->ctx_roociDirPath)
+    OCIDirPathAbort(pdp->ctx_roociDirPath, pcon->err_roociCon);
+
+  if (pdp->str_roociDirPath)
+    OCIHandleFree(pdp->str_roociDirPath, OCI_HTYPE_DIRPATH_STREAM);
+  if (pdp->ca_roociDirPath)
+    OCIHandleFree(pdp->ca_roociDirPath, OCI_HTYPE_DIRPATH_COLUMN_ARRAY);
+  if (pdp->ctx_roociDirPath)
+    OCIHandleFree(pdp->ctx_roociDirPath, OCI_HTYPE_DIRPATH_CTX);
+
+  pdp->str_roociDirPath = NULL;
+  pdp->ca_roociDirPath  = NULL;
+  pdp->ctx_roociDirPath = NULL;
+} /* end of roociDirPathFree */
+
 /* ------------------------- roociStmtExec -------------------------------- */
 
 sword roociStmtExec(roociRes *pres, ub4 noOfRows, ub2 styp, int *rows_affected)
+{
+  return roociStmtExecute(pres, noOfRows, styp, rows_affected, TRUE);
+} /* end of roociStmtExec */
+
+/* ------------------------------ roociStmtRun ---------------------------- */
+
+sword roociStmtRun(roociRes *pres, ub4 noOfRows, ub2 styp, int *rows_affected)
+{
+  /* no R interrupt check, this may run in a worker thread */
+  return roociStmtExecute(pres, noOfRows, styp, rows_affected, FALSE);
+} /* end of roociStmtRun */
+
+/* ------------------------- roociStmtExecute ----------------------------- */
+
+static sword roociStmtExecute(roociRes *pres, ub4 noOfRows, ub2 styp,
+                              int *rows_affected, boolean interrupt)
 {
   sword         rc              = OCI_ERROR;
   roociThrCtx   thrCtx;
@@ -1071,7 +1629,7 @@ sword roociStmtExec(roociRes *pres, ub4 noOfRows, ub2 styp, int *rows_affected)
   ** With threaded execution, R seems to be way too slow, check with
   ** R Development first before enabling it.
   */
-  if (pcon->ctx_roociCon->control_c_roociCtx)
+  if (interrupt && pcon->ctx_roociCon->control_c_roociCtx)
   {
     /* begin a thread to execute the query */
     rc = roociBeginThrdHndler(&thrCtx);
@@ -1088,17 +1646,18 @@ sword roociStmtExec(roociRes *pres, ub4 noOfRows, ub2 styp, int *rows_affected)
 
   *rows_affected = (int)aff_rows;
   return thrCtx.rc_roociThrCtx;
-} /* end of roociStmtExec */
+} /* end of roociStmtExecute */
 
 /* --------------------------- roociBindData ------------------------------ */
 
-sword roociBindData(roociRes *pres, ub4 bufPos, ub1 form_of_use,
+sword roociBindData(roociRes *pres, ub4 bufPos, void *dat, ub1 form_of_use,
                     const char *name)
 {
-  OCIBind   *bndp;
-  sword      rc;
-  roociCon  *pcon = pres->con_roociRes;
-  void      *bind_data;
+  OCIBind      *bndp;
+  sword         rc;
+  roociCon     *pcon = pres->con_roociRes;
+  roociColType *btyp = &pres->btyp_roociRes[bufPos-1];
+  void         *bind_data;
 
   if (pres->btyp_roociRes[bufPos-1].extyp_roociColType == SQLT_RSET)
   {
@@ -1118,9 +1677,23 @@ sword roociBindData(roociRes *pres, ub4 bufPos, ub1 form_of_use,
     else
       bind_data = (void *)&pres->stm_cur_roociRes[CursorPosition-1];
   }
+  else if (dat)
+    /* bind straight to the caller's array, e.g. an R vector */
+    bind_data = dat;
   else
     bind_data = (void *)pres->bdat_roociRes[bufPos-1];
 
+  /* the bind of a previous chunk or execute still holds these buffers */
+  if ((btyp->extyp_roociColType != SQLT_RSET) &&
+      (btyp->extyp_roociColType != SQLT_NTY) &&
+      (btyp->lbuf_roociColType == bind_data) &&
+      (btyp->lind_roociColType == pres->bind_roociRes[bufPos-1]) &&
+      (btyp->llen_roociColType == pres->alen_roociRes[bufPos-1]) &&
+      (btyp->lsiz_roociColType == pres->bsiz_roociRes[bufPos-1]) &&
+      (btyp->ltyp_roociColType == btyp->extyp_roociColType) &&
+      (btyp->lfrm_roociColType == form_of_use))
+    return OCI_SUCCESS;
+
   /* bind data */
   if (name)
   {
@@ -1170,6 +1743,16 @@ sword roociBindData(roociRes *pres, ub4 bufPos, ub1 form_of_use,
     rc = OCIAttrSet(bndp, (ub4)OCI_HTYPE_BIND, &form_of_use, (ub4)0,
                     (ub4)OCI_ATTR_CHARSET_FORM, pcon->err_roociCon);
 
+  if (rc == OCI_SUCCESS)
+  {
+    btyp->lbuf_roociColType = bind_data;
+    btyp->lind_roociColType = pres->bind_roociRes[bufPos-1];
+    btyp->llen_roociColType = pres->alen_roociRes[bufPos-1];
+    btyp->lsiz_roociColType = pres->bsiz_roociRes[bufPos-1];
+    btyp->ltyp_roociColType = btyp->extyp_roociColType;
+    btyp->lfrm_roociColType = form_of_use;
+  }
+
   return rc;
 } /* end of roociBindData */
 
@@ -1191,6 +1774,7 @@ sword roociResDefine(roociRes *pres)
   roociCtx       *pctx              = pcon->ctx_roociCon;
   int             fcur              = 0;
   ub1            *dat               = NULL; 
+  double          width             = 0;
 
   /* get number of columns */
   /* if cursor is present, use statement handle bound to that cursor */
@@ -1214,6 +1798,9 @@ sword roociResDefine(roociRes *pres)
       !pres->ind_roociRes  || !pres->len_roociRes  || !pres->siz_roociRes)
     return ROOCI_DRV_ERR_MEM_FAIL;
 
+  /* DATE and TIMESTAMP(0) are decoded in C for an offset session time zone */
+  roociSessionTimeZone(pres);
+
   /* describe columns */
   for (cid = 0; cid < pres->ncol_roociRes; cid++)
   {
@@ -1223,6 +1810,22 @@ sword roociResDefine(roociRes *pres)
     if (rc != OCI_SUCCESS)
       return rc;
 
+    width += (double)pres->siz_roociRes[cid] + sizeof(sb2) + sizeof(ub2);
+  }
+
+  /* fit the define buffers of one fetch into the byte budget */
+  if (pres->fbytes_roociRes > 0 && !pres->prefetch_roociRes && width > 0)
+  {
+    double  rows = pres->fbytes_roociRes / width;
+
+    pres->nrows_roociRes = (rows < 1) ? 1 :
+                           (rows > ROOCI_BULK_READ_MAX) ? ROOCI_BULK_READ_MAX :
+                                                          (int)rows;
+  }
+
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    etyp  = pres->typ_roociRes[cid].extyp_roociColType;
     nrows = pres->prefetch_roociRes ? 1 : pres->nrows_roociRes;
     /* allocate define buffers */
     ROOCI_MEM_ALLOC(pres->dat_roociRes[cid], 
@@ -1394,30 +1997,742 @@ sword roociResDefine(roociRes *pres)
     if (rc == OCI_ERROR)
       return rc;
 
-    if (etyp == SQLT_NTY)
-      rc = OCIDefineObject(defp, pcon->err_roociCon,
-                 pres->typ_roociRes[cid].obtyp_roociColType.otyp_roociObjType,
-                           (void **)pres->dat_roociRes[cid], NULL, NULL, 0);
+    if (etyp == SQLT_NTY)
+      rc = OCIDefineObject(defp, pcon->err_roociCon,
+                 pres->typ_roociRes[cid].obtyp_roociColType.otyp_roociObjType,
+                           (void **)pres->dat_roociRes[cid], NULL, NULL, 0);
+
+
+    if (etyp == SQLT_REF)
+      rc = OCIDefineObject(defp, pcon->err_roociCon, (OCIType *)0,
+                           (void **)pres->dat_roociRes[cid], NULL, NULL, 0);
+
+
+    if (pres->form_roociRes[cid])
+    {
+      rc = OCIAttrSet(defp, (ub4)OCI_HTYPE_DEFINE, &pres->form_roociRes[cid],
+                      (ub4)0, (ub4)OCI_ATTR_CHARSET_FORM, pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return rc;
+    }
+
+#if OCI_MAJOR_VERSION > 10
+    /* LOB length and small LOB data are returned with the fetched rows */
+    if (((etyp == SQLT_CLOB) || (etyp == SQLT_BLOB)) &&
+        !pcon->timesten_rociCon)
+    {
+      boolean  preflen = TRUE;
+      ub4      prefsiz = ROOCI_LOB_PREFETCH;
+
+      rc = OCIAttrSet(defp, (ub4)OCI_HTYPE_DEFINE, &preflen, (ub4)0,
+                      (ub4)OCI_ATTR_LOBPREFETCH_LENGTH, pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return rc;
+
+      rc = OCIAttrSet(defp, (ub4)OCI_HTYPE_DEFINE, &prefsiz, (ub4)0,
+                      (ub4)OCI_ATTR_LOBPREFETCH_SIZE, pcon->err_roociCon);
+      if (rc == OCI_ERROR)
+        return rc;
+
+      rc = roociLobAlloc(pres, cid, nrows);
+      if (rc != OCI_SUCCESS)
+        return rc;
+    }
+#endif
+  }
+
+  return rc;
+
+} /* end roociResDefine */
+
+/* ---------------------------- roociResDefineAt -------------------------- */
+
+sword roociResDefineAt(roociRes *pres, int cid, void *dat, sb2 *ind,
+                       ub2 *len)
+{
+  sword           rc;
+  OCIDefine      *defp = NULL;                             /* define handle */
+  roociCon       *pcon = pres->con_roociRes;
+
+  /*
+  ** Only for columns that need no descriptors or objects. A NULL buffer
+  ** re-defines the column at its own define buffer.
+  */
+  rc = OCIDefineByPos(pres->curstm_roociRes, &defp, pcon->err_roociCon,
+                      (ub4)(cid + 1),
+                      dat ? dat : pres->dat_roociRes[cid],
+                      pres->siz_roociRes[cid],
+                      pres->typ_roociRes[cid].extyp_roociColType,
+                      ind ? ind : pres->ind_roociRes[cid],
+                      len ? len : pres->len_roociRes[cid],
+                      NULL, OCI_DEFAULT);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  if (pres->form_roociRes[cid])
+    rc = OCIAttrSet(defp, (ub4)OCI_HTYPE_DEFINE, &pres->form_roociRes[cid],
+                    (ub4)0, (ub4)OCI_ATTR_CHARSET_FORM, pcon->err_roociCon);
+
+  return rc;
+} /* end roociResDefineAt */
+
+/* ----------------------------- roociPipeInit ---------------------------- */
+
+sword roociPipeInit(roociRes *pres)
+{
+  roociPipe  *pipe;
+  int         nrows = pres->prefetch_roociRes ? 1 : pres->nrows_roociRes;
+  int         cid;
+
+  if (pres->pipe_roociRes)
+    return OCI_SUCCESS;
+
+  ROOCI_MEM_ALLOC(pipe, 1, sizeof(roociPipe));
+  if (!pipe)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  pres->pipe_roociRes = pipe;
+
+  ROOCI_MEM_ALLOC(pipe->dat_roociPipe, pres->ncol_roociRes, sizeof(void *));
+  ROOCI_MEM_ALLOC(pipe->ind_roociPipe, pres->ncol_roociRes, sizeof(sb2 *));
+  ROOCI_MEM_ALLOC(pipe->len_roociPipe, pres->ncol_roociRes, sizeof(ub2 *));
+  if (!pipe->dat_roociPipe || !pipe->ind_roociPipe || !pipe->len_roociPipe)
+  {
+    roociPipeFree(pres);
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+
+  /* a second set of define buffers of the same size */
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    ROOCI_MEM_ALLOC(pipe->dat_roociPipe[cid],
+                    (nrows * pres->siz_roociRes[cid]), sizeof(ub1));
+    ROOCI_MEM_ALLOC(pipe->ind_roociPipe[cid], nrows, sizeof(sb2));
+    ROOCI_MEM_ALLOC(pipe->len_roociPipe[cid], nrows, sizeof(ub2));
+
+    if (!pipe->dat_roociPipe[cid] || !pipe->ind_roociPipe[cid] ||
+        !pipe->len_roociPipe[cid])
+    {
+      roociPipeFree(pres);
+      return ROOCI_DRV_ERR_MEM_FAIL;
+    }
+  }
+
+  pipe->state_roociPipe = ROOCI_PIPE_IDLE;
+
+  return OCI_SUCCESS;
+} /* end roociPipeInit */
+
+/* ----------------------------- roociPipeExec ---------------------------- */
+
+static void roociPipeExec(void *ctx)
+{
+  roociRes   *pres = (roociRes *)ctx;
+  roociPipe  *pipe = pres->pipe_roociRes;
+  int         cid;
+
+  /* point the defines at the spare buffers and fetch into them */
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    pipe->rc_roociPipe = roociResDefineAt(pres, cid, pipe->dat_roociPipe[cid],
+                                          pipe->ind_roociPipe[cid],
+                                          pipe->len_roociPipe[cid]);
+    if (pipe->rc_roociPipe == OCI_ERROR)
+      return;
+  }
+
+  pipe->rc_roociPipe = roociFetchData(pres, &pipe->rows_roociPipe,
+                                      &pipe->eof_roociPipe);
+} /* end roociPipeExec */
+
+/* ---------------------------- roociPipeFetch ---------------------------- */
+
+sword roociPipeFetch(roociRes *pres, ub4 *rows_fetched, boolean *end_of_fetch)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+  roociCon   *pcon = pres->con_roociRes;
+  OCIEnv     *envh = pcon->ctx_roociCon->env_roociCtx;
+  void       *dat;
+  sb2        *ind;
+  ub2        *len;
+  int         cid;
+
+  /* the first batch is fetched here, later ones were fetched ahead */
+  if (pipe->state_roociPipe == ROOCI_PIPE_IDLE)
+    roociPipeExec(pres);
+  else
+    roociPipeWait(pres, FALSE);
+  pipe->state_roociPipe = ROOCI_PIPE_IDLE;
+
+  *rows_fetched = pipe->rows_roociPipe;
+  *end_of_fetch = pipe->eof_roociPipe;
+  if (pipe->rc_roociPipe == OCI_ERROR)
+    return pipe->rc_roociPipe;
+
+  /* the fetched batch becomes current, its buffers are taken by the next */
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    dat = pres->dat_roociRes[cid];
+    ind = pres->ind_roociRes[cid];
+    len = pres->len_roociRes[cid];
+    pres->dat_roociRes[cid] = pipe->dat_roociPipe[cid];
+    pres->ind_roociRes[cid] = pipe->ind_roociPipe[cid];
+    pres->len_roociRes[cid] = pipe->len_roociPipe[cid];
+    pipe->dat_roociPipe[cid] = dat;
+    pipe->ind_roociPipe[cid] = ind;
+    pipe->len_roociPipe[cid] = len;
+  }
+
+  if (pipe->eof_roociPipe)
+    return pipe->rc_roociPipe;
+
+  /* fetch the next batch while this one is converted */
+  if ((OCIThreadIdInit(envh, pcon->err_roociCon,
+                       &pipe->tid_roociPipe) == OCI_SUCCESS) &&
+      (OCIThreadHndInit(envh, pcon->err_roociCon,
+                        &pipe->thd_roociPipe) == OCI_SUCCESS) &&
+      (OCIThreadCreate(envh, pcon->err_roociCon, roociPipeExec, (void *)pres,
+                       pipe->tid_roociPipe,
+                       pipe->thd_roociPipe) == OCI_SUCCESS))
+    pipe->state_roociPipe = ROOCI_PIPE_BUSY;
+  else
+  {
+    /* without a thread the next batch is fetched when needed */
+    if (pipe->thd_roociPipe)
+      OCIThreadHndDestroy(envh, pcon->err_roociCon, &pipe->thd_roociPipe);
+    if (pipe->tid_roociPipe)
+      OCIThreadIdDestroy(envh, pcon->err_roociCon, &pipe->tid_roociPipe);
+    pipe->thd_roociPipe = NULL;
+    pipe->tid_roociPipe = NULL;
+  }
+
+  return OCI_SUCCESS;
+} /* end roociPipeFetch */
+
+/* ----------------------------- roociPipeWait ---------------------------- */
+
+void roociPipeWait(roociRes *pres, boolean cancel)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+  roociCon   *pcon = pres->con_roociRes;
+  OCIEnv     *envh = pcon->ctx_roociCon->env_roociCtx;
+
+  if (!pipe || (pipe->state_roociPipe != ROOCI_PIPE_BUSY))
+    return;
+
+  /* a batch no longer wanted is interrupted on the server */
+  if (cancel)
+    OCIBreak(pcon->svc_roociCon, pcon->err_roociCon);
+
+  OCIThreadJoin(envh, pcon->err_roociCon, pipe->thd_roociPipe);
+  OCIThreadClose(envh, pcon->err_roociCon, pipe->thd_roociPipe);
+  OCIThreadHndDestroy(envh, pcon->err_roociCon, &pipe->thd_roociPipe);
+  OCIThreadIdDestroy(envh, pcon->err_roociCon, &pipe->tid_roociPipe);
+  pipe->thd_roociPipe = NULL;
+  pipe->tid_roociPipe = NULL;
+
+  if (cancel)
+    OCIReset(pcon->svc_roociCon, pcon->err_roociCon);
+
+  pipe->state_roociPipe = ROOCI_PIPE_READY;
+} /* end roociPipeWait */
+
+/* --------------------------- roociPipeBindInit -------------------------- */
+
+sword roociPipeBindInit(roociRes *pres)
+{
+  roociPipe  *pipe;
+  int         bid;
+
+  if (!pres->pipe_roociRes)
+  {
+    ROOCI_MEM_ALLOC(pres->pipe_roociRes, 1, sizeof(roociPipe));
+    if (!pres->pipe_roociRes)
+      return ROOCI_DRV_ERR_MEM_FAIL;
+    pres->pipe_roociRes->state_roociPipe = ROOCI_PIPE_IDLE;
+  }
+  pipe = pres->pipe_roociRes;
+
+  if (pipe->bind_roociPipe)
+    return OCI_SUCCESS;
+
+  ROOCI_MEM_ALLOC(pipe->bdat_roociPipe, pres->bcnt_roociRes, sizeof(void *));
+  ROOCI_MEM_ALLOC(pipe->bind_roociPipe, pres->bcnt_roociRes, sizeof(sb2 *));
+  ROOCI_MEM_ALLOC(pipe->alen_roociPipe, pres->bcnt_roociRes, sizeof(ub2 *));
+  ROOCI_MEM_ALLOC(pipe->bcap_roociPipe, pres->bcnt_roociRes, sizeof(size_t));
+  if (!pipe->bdat_roociPipe || !pipe->bind_roociPipe ||
+      !pipe->alen_roociPipe || !pipe->bcap_roociPipe)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+
+  /* a second set of bind buffers, data bound in place or sized for each
+     chunk has none yet */
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    ROOCI_MEM_ALLOC(pipe->bind_roociPipe[bid], pres->bmax_roociRes,
+                    sizeof(sb2));
+    ROOCI_MEM_ALLOC(pipe->alen_roociPipe[bid], pres->bmax_roociRes,
+                    sizeof(ub2));
+    if (!pipe->bind_roociPipe[bid] || !pipe->alen_roociPipe[bid])
+      return ROOCI_DRV_ERR_MEM_FAIL;
+
+    if (pres->bdat_roociRes[bid] &&
+        !(pres->btyp_roociRes[bid].bndflg_roociColType & ROOCI_COL_STR_PACK))
+    {
+      ROOCI_MEM_ALLOC(pipe->bdat_roociPipe[bid],
+                      (pres->bmax_roociRes * pres->bsiz_roociRes[bid]),
+                      sizeof(ub1));
+      if (!pipe->bdat_roociPipe[bid])
+        return ROOCI_DRV_ERR_MEM_FAIL;
+    }
+  }
+
+  return OCI_SUCCESS;
+} /* end roociPipeBindInit */
+
+/* --------------------------- roociPipeBindSwap -------------------------- */
+
+void roociPipeBindSwap(roociRes *pres)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+  void       *dat;
+  sb2        *ind;
+  ub2        *len;
+  size_t      cap;
+  int         bid;
+
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    dat = pres->bdat_roociRes[bid];
+    ind = pres->bind_roociRes[bid];
+    len = pres->alen_roociRes[bid];
+    cap = pres->btyp_roociRes[bid].bcap_roociColType;
+    pres->bdat_roociRes[bid] = pipe->bdat_roociPipe[bid];
+    pres->bind_roociRes[bid] = pipe->bind_roociPipe[bid];
+    pres->alen_roociRes[bid] = pipe->alen_roociPipe[bid];
+    pres->btyp_roociRes[bid].bcap_roociColType = pipe->bcap_roociPipe[bid];
+    pipe->bdat_roociPipe[bid] = dat;
+    pipe->bind_roociPipe[bid] = ind;
+    pipe->alen_roociPipe[bid] = len;
+    pipe->bcap_roociPipe[bid] = cap;
+  }
+} /* end roociPipeBindSwap */
+
+/* -------------------------- roociPipeExecStart -------------------------- */
+
+sword roociPipeExecStart(roociRes *pres, ub4 noOfRows, ub2 styp)
+{
+  roociPipe    *pipe = pres->pipe_roociRes;
+  roociThrCtx  *thr  = &pipe->exec_roociPipe;
+  roociCon     *pcon = pres->con_roociRes;
+  OCIEnv       *envh = pcon->ctx_roociCon->env_roociCtx;
+
+  /* set up the thread context */
+  thr->pcon_roociThrCtx      = pcon;
+  thr->pres_roociThrCtx      = pres;
+  thr->nrows_roociThrCtx     = noOfRows;
+  thr->styp_roociThrCtx      = styp;
+  thr->aff_rows_roociThrCtx  = &pipe->rows_roociPipe;
+  thr->bExecOver_roociThrCtx = FALSE;
+  thr->tid_roociThrCtx       = NULL;
+  thr->thdhp_roociThrCtx     = NULL;
+  pipe->rows_roociPipe       = 0;
+
+  /* execute while the caller copies the next chunk */
+  if (roociBeginThrdHndler(thr) == OCI_SUCCESS)
+  {
+    pipe->tid_roociPipe   = thr->tid_roociThrCtx;
+    pipe->thd_roociPipe   = thr->thdhp_roociThrCtx;
+    pipe->state_roociPipe = ROOCI_PIPE_BUSY;
+    return OCI_SUCCESS;
+  }
+
+  /* without a thread the chunk is executed here */
+  if (thr->thdhp_roociThrCtx)
+    OCIThreadHndDestroy(envh, pcon->err_roociCon, &thr->thdhp_roociThrCtx);
+  if (thr->tid_roociThrCtx)
+    OCIThreadIdDestroy(envh, pcon->err_roociCon, &thr->tid_roociThrCtx);
+  thr->thdhp_roociThrCtx = NULL;
+  thr->tid_roociThrCtx   = NULL;
+
+  roociThrExecCmd(thr);
+  pipe->state_roociPipe = ROOCI_PIPE_READY;
+
+  return OCI_SUCCESS;
+} /* end roociPipeExecStart */
+
+/* -------------------------- roociPipeExecWait --------------------------- */
+
+sword roociPipeExecWait(roociRes *pres, int *rows_affected)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+
+  if (!pipe || (pipe->state_roociPipe == ROOCI_PIPE_IDLE))
+    return OCI_SUCCESS;
+
+  roociPipeWait(pres, FALSE);
+  pipe->state_roociPipe = ROOCI_PIPE_IDLE;
+
+  *rows_affected = (int)pipe->rows_roociPipe;
+  return pipe->exec_roociPipe.rc_roociThrCtx;
+} /* end roociPipeExecWait */
+
+/* --------------------------- roociThrExecStart -------------------------- */
+
+sword roociThrExecStart(roociThrCtx *thr, roociRes *pres, ub4 noOfRows,
+                        ub2 styp, ub4 *rows)
+{
+  roociCon     *pcon = pres->con_roociRes;
+  OCIEnv       *envh = pcon->ctx_roociCon->env_roociCtx;
+
+  /* set up the thread context */
+  thr->pcon_roociThrCtx      = pcon;
+  thr->pres_roociThrCtx      = pres;
+  thr->nrows_roociThrCtx     = noOfRows;
+  thr->styp_roociThrCtx      = styp;
+  thr->aff_rows_roociThrCtx  = rows;
+  thr->bExecOver_roociThrCtx = FALSE;
+  thr->tid_roociThrCtx       = NULL;
+  thr->thdhp_roociThrCtx     = NULL;
+  *rows                      = 0;
+
+  if (roociBeginThrdHndler(thr) == OCI_SUCCESS)
+    return OCI_SUCCESS;
+
+  /* without a thread the statement is executed here */
+  if (thr->thdhp_roociThrCtx)
+    OCIThreadHndDestroy(envh, pcon->err_roociCon, &thr->thdhp_roociThrCtx);
+  if (thr->tid_roociThrCtx)
+    OCIThreadIdDestroy(envh, pcon->err_roociCon, &thr->tid_roociThrCtx);
+  thr->thdhp_roociThrCtx = NULL;
+  thr->tid_roociThrCtx   = NULL;
+
+  roociThrExecCmd(thr);
+
+  return OCI_SUCCESS;
+} /* end roociThrExecStart */
+
+/* --------------------------- roociThrExecWait --------------------------- */
+
+sword roociThrExecWait(roociThrCtx *thr)
+{
+  roociCon  *pcon = thr->pcon_roociThrCtx;
+  OCIEnv    *envh;
+
+  if (!pcon)
+    return OCI_SUCCESS;
+  envh = pcon->ctx_roociCon->env_roociCtx;
+
+  if (thr->thdhp_roociThrCtx)
+  {
+    OCIThreadJoin(envh, pcon->err_roociCon, thr->thdhp_roociThrCtx);
+    OCIThreadClose(envh, pcon->err_roociCon, thr->thdhp_roociThrCtx);
+    OCIThreadHndDestroy(envh, pcon->err_roociCon, &thr->thdhp_roociThrCtx);
+  }
+  if (thr->tid_roociThrCtx)
+    OCIThreadIdDestroy(envh, pcon->err_roociCon, &thr->tid_roociThrCtx);
+  thr->thdhp_roociThrCtx = NULL;
+  thr->tid_roociThrCtx   = NULL;
+  thr->pcon_roociThrCtx  = NULL;
+
+  return thr->rc_roociThrCtx;
+} /* end roociThrExecWait */
+
+/* ----------------------------- roociThrCreate --------------------------- */
+
+sword roociThrCreate(roociCon *pcon, void (*fn)(void *), void *arg,
+                     OCIThreadId **tid, OCIThreadHandle **thd)
+{
+  OCIEnv    *envh = pcon->ctx_roociCon->env_roociCtx;
+  sword      rc;
+
+  *tid = NULL;
+  *thd = NULL;
+
+  if (((rc = OCIThreadIdInit(envh, pcon->err_roociCon, tid)) ==
+                                                             OCI_SUCCESS) &&
+      ((rc = OCIThreadHndInit(envh, pcon->err_roociCon, thd)) ==
+                                                             OCI_SUCCESS) &&
+      ((rc = OCIThreadCreate(envh, pcon->err_roociCon, fn, arg, *tid,
+                             *thd)) == OCI_SUCCESS))
+    return OCI_SUCCESS;
+
+  /* without a thread the caller runs fn itself */
+  if (*thd)
+    OCIThreadHndDestroy(envh, pcon->err_roociCon, thd);
+  if (*tid)
+    OCIThreadIdDestroy(envh, pcon->err_roociCon, tid);
+  *thd = NULL;
+  *tid = NULL;
+
+  return rc;
+} /* end roociThrCreate */
+
+/* ------------------------------ roociThrJoin ---------------------------- */
+
+void roociThrJoin(roociCon *pcon, OCIThreadId **tid, OCIThreadHandle **thd,
+                  boolean cancel)
+{
+  OCIEnv    *envh = pcon->ctx_roociCon->env_roociCtx;
+
+  if (!*thd)
+    return;
+
+  /* a call no longer wanted is interrupted on the server */
+  if (cancel)
+    OCIBreak(pcon->svc_roociCon, pcon->err_roociCon);
+
+  OCIThreadJoin(envh, pcon->err_roociCon, *thd);
+  OCIThreadClose(envh, pcon->err_roociCon, *thd);
+  OCIThreadHndDestroy(envh, pcon->err_roociCon, thd);
+  OCIThreadIdDestroy(envh, pcon->err_roociCon, tid);
+  *thd = NULL;
+  *tid = NULL;
+
+  if (cancel)
+    OCIReset(pcon->svc_roociCon, pcon->err_roociCon);
+} /* end roociThrJoin */
+
+/* ------------------------------- roociSleep ----------------------------- */
+
+void roociSleep(ub4 msec)
+{
+#ifdef WIN32
+  Sleep(msec);
+#else
+  usleep((useconds_t)msec * 1000);
+#endif
+} /* end roociSleep */
+
+/* ------------------------------- roociClock ----------------------------- */
+
+double roociClock(void)
+{
+#ifdef WIN32
+  return (double)GetTickCount64();
+#else
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec * 1000 + (double)ts.tv_nsec / 1000000;
+#endif
+} /* end roociClock */
+
+/* --------------------------- roociStmtRowCount -------------------------- */
+
+sword roociStmtRowCount(roociRes *pres, ub4 *rows)
+{
+  *rows = 0;
+  return OCIAttrGet(pres->stm_roociRes, OCI_HTYPE_STMT, rows, NULL,
+                    OCI_ATTR_ROW_COUNT, pres->con_roociRes->err_roociCon);
+} /* end roociStmtRowCount */
+
+/* ---------------------------- roociBatchErrInit ------------------------- */
+
+sword roociBatchErrInit(roociRes *pres)
+{
+  roociBatchErr  *berr;
+  sword           rc;
+
+  if (pres->berr_roociRes)
+    return OCI_SUCCESS;
+
+  ROOCI_MEM_ALLOC(berr, 1, sizeof(roociBatchErr));
+  if (!berr)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+  pres->berr_roociRes = berr;
+
+  /* each row error is read into this handle */
+  rc = OCIHandleAlloc(pres->con_roociRes->ctx_roociCon->env_roociCtx,
+                      (void **)&berr->err_roociBatchErr, OCI_HTYPE_ERROR,
+                      0, NULL);
+  if (rc != OCI_SUCCESS)
+    roociBatchErrFree(pres);
+
+  return rc;
+} /* end roociBatchErrInit */
+
+/* ---------------------------- roociBatchErrGet -------------------------- */
+
+sword roociBatchErrGet(roociRes *pres, ub4 base)
+{
+  roociBatchErr  *berr = pres->berr_roociRes;
+  OCIError       *errh = pres->con_roociRes->err_roociCon;
+  OCIError       *rowh;
+  ub4             nerr = 0;
+  ub4             eid;
+  ub4             row;
+  sb4             code;
+  text            msg[ROOCI_ERR_LEN];
+  size_t          len;
+  sword           rc;
+
+  rc = OCIAttrGet(pres->stm_roociRes, OCI_HTYPE_STMT, &nerr, NULL,
+                  OCI_ATTR_NUM_DML_ERRORS, errh);
+  if (rc != OCI_SUCCESS)
+    return rc;
+
+  /* grow the arrays to hold the errors of this execute */
+  if (berr->cnt_roociBatchErr + nerr > berr->max_roociBatchErr)
+  {
+    ub4     max  = 2 * (berr->cnt_roociBatchErr + nerr);
+    ub4    *rows;
+    sb4    *codes;
+    char  **msgs;
+
+    ROOCI_MEM_REALLOC(rows, berr->row_roociBatchErr, max, sizeof(ub4));
+    if (rows)
+      berr->row_roociBatchErr = rows;
+    ROOCI_MEM_REALLOC(codes, berr->code_roociBatchErr, max, sizeof(sb4));
+    if (codes)
+      berr->code_roociBatchErr = codes;
+    ROOCI_MEM_REALLOC(msgs, berr->msg_roociBatchErr, max, sizeof(char *));
+    if (msgs)
+      berr->msg_roociBatchErr = msgs;
+
+    if (!rows || !codes || !msgs)
+      return ROOCI_DRV_ERR_MEM_FAIL;
+    berr->max_roociBatchErr = max;
+  }
+
+  for (eid = 0; eid < nerr; eid++)
+  {
+    rowh = berr->err_roociBatchErr;
+    if (((rc = OCIParamGet(errh, OCI_HTYPE_ERROR, errh, (void **)&rowh,
+                           eid)) != OCI_SUCCESS) ||
+        ((rc = OCIAttrGet(rowh, OCI_HTYPE_ERROR, &row, NULL,
+                          OCI_ATTR_DML_ROW_OFFSET, errh)) != OCI_SUCCESS))
+      return rc;
+
+    msg[0] = '\0';
+    code   = 0;
+    OCIErrorGet(rowh, 1, NULL, &code, msg, (ub4)sizeof(msg),
+                OCI_HTYPE_ERROR);
 
+    /* drop the trailing new line */
+    len = strlen((const char *)msg);
+    if (len && (msg[len - 1] == '\n'))
+      msg[--len] = '\0';
 
-    if (etyp == SQLT_REF)
-      rc = OCIDefineObject(defp, pcon->err_roociCon, (OCIType *)0,
-                           (void **)pres->dat_roociRes[cid], NULL, NULL, 0);
+    ROOCI_MEM_MALLOC(berr->msg_roociBatchErr[berr->cnt_roociBatchErr],
+                     len + 1, sizeof(char));
+    if (!berr->msg_roociBatchErr[berr->cnt_roociBatchErr])
+      return ROOCI_DRV_ERR_MEM_FAIL;
+    memcpy(berr->msg_roociBatchErr[berr->cnt_roociBatchErr], msg, len + 1);
 
+    berr->row_roociBatchErr[berr->cnt_roociBatchErr]  = base + row;
+    berr->code_roociBatchErr[berr->cnt_roociBatchErr] = code;
+    berr->cnt_roociBatchErr++;
+  }
 
-    if (pres->form_roociRes[cid])
-    {
-      rc = OCIAttrSet(defp, (ub4)OCI_HTYPE_DEFINE, &pres->form_roociRes[cid],
-                      (ub4)0, (ub4)OCI_ATTR_CHARSET_FORM, pcon->err_roociCon);
-      if (rc == OCI_ERROR)
-        return rc;
-    }
+  return OCI_SUCCESS;
+} /* end roociBatchErrGet */
+
+/* ---------------------------- roociBatchErrReset ------------------------ */
+
+void roociBatchErrReset(roociRes *pres)
+{
+  roociBatchErr  *berr = pres->berr_roociRes;
+  ub4             eid;
 
+  if (!berr)
+    return;
+
+  for (eid = 0; eid < berr->cnt_roociBatchErr; eid++)
+  {
+    ROOCI_MEM_FREE(berr->msg_roociBatchErr[eid]);
   }
+  berr->cnt_roociBatchErr = 0;
+} /* end roociBatchErrReset */
 
-  return rc;
+/* ---------------------------- roociBatchErrFree ------------------------- */
 
-} /* end roociResDefine */
+void roociBatchErrFree(roociRes *pres)
+{
+  roociBatchErr  *berr = pres->berr_roociRes;
+
+  if (!berr)
+    return;
+
+  roociBatchErrReset(pres);
+  if (berr->err_roociBatchErr)
+    OCIHandleFree(berr->err_roociBatchErr, OCI_HTYPE_ERROR);
+  if (berr->row_roociBatchErr)
+  {
+    ROOCI_MEM_FREE(berr->row_roociBatchErr);
+  }
+  if (berr->code_roociBatchErr)
+  {
+    ROOCI_MEM_FREE(berr->code_roociBatchErr);
+  }
+  if (berr->msg_roociBatchErr)
+  {
+    ROOCI_MEM_FREE(berr->msg_roociBatchErr);
+  }
+  ROOCI_MEM_FREE(pres->berr_roociRes);
+} /* end roociBatchErrFree */
+
+/* ----------------------------- roociPipeFree ---------------------------- */
+
+void roociPipeFree(roociRes *pres)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+  int         cid;
+
+  if (!pipe)
+    return;
+
+  roociPipeWait(pres, TRUE);
+
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    if (pipe->dat_roociPipe && pipe->dat_roociPipe[cid])
+      ROOCI_MEM_FREE(pipe->dat_roociPipe[cid]);
+    if (pipe->ind_roociPipe && pipe->ind_roociPipe[cid])
+      ROOCI_MEM_FREE(pipe->ind_roociPipe[cid]);
+    if (pipe->len_roociPipe && pipe->len_roociPipe[cid])
+      ROOCI_MEM_FREE(pipe->len_roociPipe[cid]);
+  }
+
+  roociPipeBindFree(pres);
+
+  if (pipe->dat_roociPipe)
+    ROOCI_MEM_FREE(pipe->dat_roociPipe);
+  if (pipe->ind_roociPipe)
+    ROOCI_MEM_FREE(pipe->ind_roociPipe);
+  if (pipe->len_roociPipe)
+    ROOCI_MEM_FREE(pipe->len_roociPipe);
+
+  ROOCI_MEM_FREE(pres->pipe_roociRes);
+} /* end roociPipeFree */
+
+/* --------------------------- roociPipeBindFree -------------------------- */
+
+void roociPipeBindFree(roociRes *pres)
+{
+  roociPipe  *pipe = pres->pipe_roociRes;
+  int         bid;
+
+  if (!pipe)
+    return;
+
+  for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+  {
+    if (pipe->bdat_roociPipe && pipe->bdat_roociPipe[bid])
+      ROOCI_MEM_FREE(pipe->bdat_roociPipe[bid]);
+    if (pipe->bind_roociPipe && pipe->bind_roociPipe[bid])
+      ROOCI_MEM_FREE(pipe->bind_roociPipe[bid]);
+    if (pipe->alen_roociPipe && pipe->alen_roociPipe[bid])
+      ROOCI_MEM_FREE(pipe->alen_roociPipe[bid]);
+  }
+
+  if (pipe->bdat_roociPipe)
+    ROOCI_MEM_FREE(pipe->bdat_roociPipe);
+  if (pipe->bind_roociPipe)
+    ROOCI_MEM_FREE(pipe->bind_roociPipe);
+  if (pipe->alen_roociPipe)
+    ROOCI_MEM_FREE(pipe->alen_roociPipe);
+  if (pipe->bcap_roociPipe)
+    ROOCI_MEM_FREE(pipe->bcap_roociPipe);
+} /* end roociPipeBindFree */
 
 /* ------------------------- roociDescCol --------------------------------- */
 
@@ -1547,6 +2862,17 @@ sword roociDescCol(roociRes *pres, ub4 colId, ub2 *extTyp, oratext **colName,
     pres->typ_roociRes[colId-1].extyp_roociColType = *extTyp =
                     rodbiTypeExt(pres->typ_roociRes[colId-1].typ_roociColType);
 
+    /*
+    ** With a fixed offset session time zone a DATE, and a TIMESTAMP without
+    ** fractional seconds, is fetched in the 7 byte format and decoded in C
+    ** instead of an OCI subtraction per value. Other timestamps keep the
+    ** conversion through OCI as there is no raw external format for them.
+    */
+    if (pres->fixtz_roociRes &&
+        (coltyp->typ_roociColType == RODBI_DATE ||
+         (coltyp->typ_roociColType == RODBI_TIME && *colsca == 0)))
+      coltyp->extyp_roociColType = *extTyp = SQLT_DAT;
+
     /* get buffer length */
     switch(*extTyp)
     {
@@ -1565,6 +2891,10 @@ sword roociDescCol(roociRes *pres, ub4 colId, ub2 *extTyp, oratext **colName,
         break;
 #endif
 
+      case SQLT_DAT:
+        pres->siz_roociRes[colId-1] = ROOCI_DATE_LEN;
+        break;
+
       case SQLT_TIMESTAMP:
       case SQLT_TIMESTAMP_LTZ:
         pres->siz_roociRes[colId-1] = sizeof(OCIDateTime *);
@@ -2248,10 +3578,171 @@ sword roociFetchData(roociRes *pres, ub4 *rows_fetched, boolean *end_of_fetch)
   /* get no of rows fetched */
   rc = OCIAttrGet(pres->curstm_roociRes, OCI_HTYPE_STMT, rows_fetched,
                   NULL, OCI_ATTR_ROWS_FETCHED, pcon->err_roociCon);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  /* read LOBs of the batch in one round trip */
+  if (pres->lob_roociRes && *rows_fetched)
+    rc = roociReadLOBArray(pres, *rows_fetched);
     
   return rc;
 } /* end of roociFetchData */
 
+/* ----------------------------- roociLobAlloc ---------------------------- */
+
+static sword roociLobAlloc(roociRes *pres, int cid, int nrows)
+{
+  roociLob  *lob;
+
+  if (!pres->lob_roociRes)
+  {
+    ROOCI_MEM_ALLOC(pres->lob_roociRes, pres->ncol_roociRes,
+                    sizeof(roociLob));
+    if (!pres->lob_roociRes)
+      return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+
+  lob = &pres->lob_roociRes[cid];
+  ROOCI_MEM_ALLOC(lob->pos_roociLob,  nrows, sizeof(oraub8));
+  ROOCI_MEM_ALLOC(lob->len_roociLob,  nrows, sizeof(sb8));
+  ROOCI_MEM_ALLOC(lob->loc_roociLob,  nrows, sizeof(OCILobLocator *));
+  ROOCI_MEM_ALLOC(lob->byte_roociLob, nrows, sizeof(oraub8));
+  ROOCI_MEM_ALLOC(lob->char_roociLob, nrows, sizeof(oraub8));
+  ROOCI_MEM_ALLOC(lob->off_roociLob,  nrows, sizeof(oraub8));
+  ROOCI_MEM_ALLOC(lob->bufp_roociLob, nrows, sizeof(void *));
+  ROOCI_MEM_ALLOC(lob->bufl_roociLob, nrows, sizeof(oraub8));
+  ROOCI_MEM_ALLOC(lob->row_roociLob,  nrows, sizeof(int));
+
+  if (!lob->pos_roociLob  || !lob->len_roociLob  || !lob->loc_roociLob  ||
+      !lob->byte_roociLob || !lob->char_roociLob || !lob->off_roociLob  ||
+      !lob->bufp_roociLob || !lob->bufl_roociLob || !lob->row_roociLob)
+    return ROOCI_DRV_ERR_MEM_FAIL;
+
+  return OCI_SUCCESS;
+} /* end of roociLobAlloc */
+
+/* --------------------------- roociReadLOBArray -------------------------- */
+
+static sword roociReadLOBArray(roociRes *pres, ub4 rows)
+{
+  sword      rc   = OCI_SUCCESS;
+  roociCon  *pcon = pres->con_roociRes;
+  int        cid;
+
+  for (cid = 0; cid < pres->ncol_roociRes; cid++)
+  {
+    roociLob        *lob  = &pres->lob_roociRes[cid];
+    OCILobLocator  **locs = (OCILobLocator **)pres->dat_roociRes[cid];
+    ub2              etyp = pres->typ_roociRes[cid].extyp_roociColType;
+    oraub8           tot  = 0;
+    ub4              cnt  = 0;
+    ub4              fcur;
+    ub4              pos;
+
+    if (!lob->len_roociLob)
+      continue;
+
+    for (fcur = 0; fcur < rows; fcur++)
+    {
+      oraub8  char_len;
+      oraub8  len;
+
+      lob->len_roociLob[fcur] = -1;
+      if (pres->ind_roociRes[cid][fcur] == OCI_IND_NULL)
+        continue;
+
+      /* served from the prefetched length */
+      rc = OCILobGetLength2(pcon->svc_roociCon, pcon->err_roociCon,
+                            locs[fcur], &char_len);
+      if (rc == OCI_ERROR)
+        return rc;
+
+      len = (etyp == SQLT_CLOB) ?
+              char_len * (oraub8)(pcon->nlsmaxwidth_roociCon) : char_len;
+
+      /* large LOBs are left to roociReadLOBCell to read on their own */
+      if ((len > ROOCI_LOB_ARRAY_MAX) || (tot + len > ROOCI_LOB_BATCH_MAX))
+        continue;
+
+      lob->pos_roociLob[fcur] = tot;
+      lob->len_roociLob[fcur] = 0;
+      if (!char_len)
+        continue;
+
+      lob->loc_roociLob[cnt]  = locs[fcur];
+      lob->byte_roociLob[cnt] = (etyp == SQLT_CLOB) ? 0 : char_len;
+      lob->char_roociLob[cnt] = (etyp == SQLT_CLOB) ? char_len : 0;
+      lob->off_roociLob[cnt]  = 1;
+      lob->bufl_roociLob[cnt] = len;
+      lob->row_roociLob[cnt]  = (int)fcur;
+      tot += len;
+      cnt++;
+    }
+
+    if (!cnt)
+      continue;
+
+    if (!lob->buf_roociLob || lob->bufsz_roociLob < tot)
+    {
+      if (lob->buf_roociLob)
+        ROOCI_MEM_FREE(lob->buf_roociLob);
+
+      lob->bufsz_roociLob = (tot / ROOCI_LOB_RND + 1) * ROOCI_LOB_RND;
+      ROOCI_MEM_MALLOC(lob->buf_roociLob, lob->bufsz_roociLob, sizeof(ub1));
+      if (!lob->buf_roociLob)
+        return ROOCI_DRV_ERR_MEM_FAIL;
+    }
+
+    for (pos = 0; pos < cnt; pos++)
+      lob->bufp_roociLob[pos] = lob->buf_roociLob +
+                                lob->pos_roociLob[lob->row_roociLob[pos]];
+
+    rc = OCILobArrayRead(pcon->svc_roociCon, pcon->err_roociCon, &cnt,
+                         lob->loc_roociLob, lob->byte_roociLob,
+                         lob->char_roociLob, lob->off_roociLob,
+                         lob->bufp_roociLob, lob->bufl_roociLob,
+                         OCI_ONE_PIECE, NULL, (OCICallbackLobArrayRead)0, 0,
+                         pres->form_roociRes[cid]);
+    if (rc == OCI_ERROR)
+      return rc;
+
+    for (pos = 0; pos < cnt; pos++)
+      lob->len_roociLob[lob->row_roociLob[pos]] =
+                                           (sb8)lob->byte_roociLob[pos];
+  }
+
+  return rc;
+} /* end of roociReadLOBArray */
+
+/* --------------------------- roociReadLOBCell --------------------------- */
+
+sword roociReadLOBCell(roociRes *pres, int cid, int row, ub1 **lob_dat,
+                       int *lob_len)
+{
+  sword            rc;
+  roociLob        *lob  = pres->lob_roociRes ? &pres->lob_roociRes[cid] :
+                                               NULL;
+  OCILobLocator   *loc  = ((OCILobLocator **)pres->dat_roociRes[cid])[row];
+  ub2              etyp = pres->typ_roociRes[cid].extyp_roociColType;
+
+  /* LOB read with the rest of its batch */
+  if (lob && lob->len_roociLob && (lob->len_roociLob[row] >= 0))
+  {
+    *lob_dat = lob->buf_roociLob + lob->pos_roociLob[row];
+    *lob_len = (int)lob->len_roociLob[row];
+    return OCI_SUCCESS;
+  }
+
+  if (etyp == SQLT_CLOB)
+    rc = roociReadLOBData(pres, loc, lob_len, pres->form_roociRes[cid]);
+  else
+    rc = roociReadBLOBData(pres, loc, lob_len, pres->form_roociRes[cid],
+                           etyp);
+
+  *lob_dat = pres->lobbuf_roociRes;
+  return rc;
+} /* end of roociReadLOBCell */
+
 /* --------------------------- roociReadLOBData --------------------------- */
 
 sword roociReadLOBData(roociRes *pres, OCILobLocator *lob_loc, int *lob_len,
@@ -2412,6 +3903,269 @@ sword roociReadDateTimeData(roociRes *pres, OCIDateTime *tstm, double *date,
   return rc;
 } /* end of roociReadDateTimeData */
 
+/* --------------------------- roociReadDateData -------------------------- */
+
+void roociReadDateData(roociRes *pres, const ub1 *dat, sb4 siz,
+                       const sb2 *ind, int cnt, double *date)
+{
+  int            i;
+
+  /*
+  ** Bytes are century + 100, year of century + 100, month, day, hour + 1,
+  ** minute + 1 and second + 1, the value is in the session time zone.
+  */
+  for (i = 0; i < cnt; i++, dat += siz)
+  {
+    if (ind[i] == OCI_IND_NULL)
+      date[i] = NA_REAL;
+    else
+    {
+      sb4 year = ((sb4)dat[0] - 100) * 100 + ((sb4)dat[1] - 100);
+
+      ROOCI_SECONDS_FROM_DAYS(&date[i],
+                              roociDaysFromCivil(year, dat[2], dat[3]),
+                              dat[4] - 1, dat[5] - 1, dat[6] - 1, 0);
+      date[i] -= pres->tzsecs_roociRes;
+    }
+  }
+} /* end of roociReadDateData */
+
+/* -------------------------- roociDaysFromCivil -------------------------- */
+
+static double roociDaysFromCivil(sb4 year, sb4 month, sb4 day)
+{
+  sb4   a;
+  sb4   y;
+  sb4   m;
+  sb4   jdn;
+
+  /* Oracle has no year 0, year -1 is 1 BC */
+  if (year < 0)
+    year++;
+
+  a = (14 - month) / 12;
+  y = year + 4800 - a;
+  m = month + 12 * a - 3;
+
+  /* Oracle uses the Julian calendar before 1582-10-15 */
+  jdn = day + (153 * m + 2) / 5 + 365 * y + y / 4;
+  if ((year > 1582) ||
+      ((year == 1582) && ((month > 10) || ((month == 10) && (day >= 15)))))
+    jdn += -y / 100 + y / 400 - 32045;
+  else
+    jdn += -32083;
+
+  return (double)(jdn - ROOCI_EPOCH_JDN);
+} /* end of roociDaysFromCivil */
+
+/* -------------------------- roociCivilFromDays -------------------------- */
+
+static void roociCivilFromDays(double days, sb4 *year, ub1 *month, ub1 *day)
+{
+  sb4   jdn = (sb4)days + ROOCI_EPOCH_JDN;
+  sb4   c;
+  sb4   d;
+  sb4   e;
+  sb4   m;
+  sb4   b = 0;
+
+  /* inverse of roociDaysFromCivil, Julian calendar before 1582-10-15 */
+  if (jdn >= 2299161)
+  {
+    sb4 a = jdn + 32044;
+
+    b = (4 * a + 3) / 146097;
+    c = a - (146097 * b) / 4;
+  }
+  else
+    c = jdn + 32082;
+
+  d = (4 * c + 3) / 1461;
+  e = c - (1461 * d) / 4;
+  m = (5 * e + 2) / 153;
+
+  *day   = (ub1)(e - (153 * m + 2) / 5 + 1);
+  *month = (ub1)(m + 3 - 12 * (m / 10));
+  *year  = 100 * b + d - 4800 + m / 10;
+
+  /* Oracle has no year 0, year -1 is 1 BC */
+  if (*year <= 0)
+    (*year)--;
+} /* end of roociCivilFromDays */
+
+/* ---------------------------- roociDateFits ----------------------------- */
+
+boolean roociDateFits(roociRes *pres, const double *date, int cnt)
+{
+  /* -4712-01-01 and 10000-01-01 in seconds since 1970 */
+  const double   lo = -210866803200.0;
+  const double   hi = 253402300800.0;
+  int            i;
+
+  for (i = 0; i < cnt; i++)
+  {
+    double  secs = date[i] + pres->tzsecs_roociRes;
+
+    if (ISNA(date[i]))
+      continue;
+    if (!R_FINITE(date[i]) || (secs < lo) || (secs >= hi) ||
+        (secs != floor(secs)))
+      return FALSE;
+  }
+
+  return TRUE;
+} /* end of roociDateFits */
+
+/* --------------------------- roociWriteDateData ------------------------- */
+
+void roociWriteDateData(roociRes *pres, const double *date, int cnt,
+                        ub1 *dat, sb2 *ind, ub2 *alen)
+{
+  int            i;
+
+  /* layout of roociReadDateData, in the session time zone */
+  for (i = 0; i < cnt; i++, dat += ROOCI_DATE_LEN)
+  {
+    double  secs;
+    double  days;
+    sb4     sod;
+    sb4     year;
+
+    alen[i] = ROOCI_DATE_LEN;
+    if (ISNA(date[i]))
+    {
+      ind[i] = OCI_IND_NULL;
+      continue;
+    }
+    ind[i] = OCI_IND_NOTNULL;
+
+    secs = date[i] + pres->tzsecs_roociRes;
+    days = floor(secs / 86400.0);
+    sod  = (sb4)(secs - days * 86400.0);
+
+    roociCivilFromDays(days, &year, &dat[2], &dat[3]);
+    dat[0] = (ub1)(100 + year / 100);
+    dat[1] = (ub1)(100 + year % 100);
+    dat[4] = (ub1)(sod / 3600 + 1);
+    dat[5] = (ub1)((sod / 60) % 60 + 1);
+    dat[6] = (ub1)(sod % 60 + 1);
+  }
+} /* end of roociWriteDateData */
+
+/* ------------------------- roociWriteTimestampData ---------------------- */
+
+sword roociWriteTimestampData(roociRes *pres, OCIDateTime **tstm,
+                              const double *date, int cnt, sb2 *ind,
+                              ub2 *alen)
+{
+  sword          rc   = OCI_SUCCESS;
+  roociCon      *pcon = pres->con_roociRes;
+  int            i;
+
+  /* fields are computed in C, a single OCI call sets them */
+  for (i = 0; i < cnt; i++)
+  {
+    double  secs;
+    double  days;
+    double  sod;
+    sb4     ss;
+    ub4     fsec;
+    sb4     year;
+    ub1     mon;
+    ub1     day;
+
+    /* NaN and infinity have no TIMESTAMP either */
+    alen[i] = (ub2)sizeof(OCIDateTime *);
+    if (!R_FINITE(date[i]))
+    {
+      ind[i] = OCI_IND_NULL;
+      continue;
+    }
+    ind[i] = OCI_IND_NOTNULL;
+
+    secs = date[i] + pres->tzsecs_roociRes;
+    days = floor(secs / 86400.0);
+    sod  = secs - days * 86400.0;
+    ss   = (sb4)sod;
+    fsec = (ub4)((sod - (double)ss) * 1e9 + 0.5);
+    if (fsec > 999999999)
+      fsec = 999999999;
+
+    roociCivilFromDays(days, &year, &mon, &day);
+    rc = OCIDateTimeConstruct(pcon->usr_roociCon, pcon->err_roociCon,
+                              tstm[i], (sb2)year, mon, day,
+                              (ub1)(ss / 3600), (ub1)((ss / 60) % 60),
+                              (ub1)(ss % 60), fsec, NULL, 0);
+    if (rc == OCI_ERROR)
+      return rc;
+  }
+
+  return rc;
+} /* end of roociWriteTimestampData */
+
+/* ------------------------- roociSessionTimeZone ------------------------- */
+
+void roociSessionTimeZone(roociRes *pres)
+{
+  sword          rc;
+  roociCon      *pcon = pres->con_roociRes;
+  roociCtx      *pctx = pcon->ctx_roociCon;
+  void          *temp = NULL;      /* pointer to remove strict-aliasing warning */
+  ub1            tznm[64];
+  ub4            tznmlen = (ub4)sizeof(tznm);
+  sb1            tzhr = 0;
+  sb1            tzmm = 0;
+  int            i;
+  static const char *utcnm[] = {"UTC", "GMT", "UCT", "Z", "Zulu",
+                                "Universal", "Greenwich", "GMT0",
+                                "Etc/UTC", "Etc/GMT", "Etc/UCT", "Etc/Zulu",
+                                "Etc/Universal", "Etc/Greenwich", "Etc/GMT0",
+                                NULL};
+
+  pres->fixtz_roociRes  = FALSE;
+  pres->tzsecs_roociRes = 0;
+
+  /* TimesTen keeps its own conversion */
+  if (pcon->timesten_rociCon)
+    return;
+
+  rc = OCIDescriptorAlloc(pctx->env_roociCtx, &temp, OCI_DTYPE_TIMESTAMP_TZ,
+                          0, NULL);
+  if (rc != OCI_SUCCESS)
+    return;
+
+  /* no time zone takes the session time zone */
+  rc = OCIDateTimeConstruct(pcon->usr_roociCon, pcon->err_roociCon,
+                            (OCIDateTime *)temp, 2000, 1, 1, 0, 0, 0, 0,
+                            NULL, 0);
+  if (rc == OCI_SUCCESS)
+    rc = OCIDateTimeGetTimeZoneName(pcon->usr_roociCon, pcon->err_roociCon,
+                                    (OCIDateTime *)temp, tznm, &tznmlen);
+  if (rc == OCI_SUCCESS)
+    rc = OCIDateTimeGetTimeZoneOffset(pcon->usr_roociCon, pcon->err_roociCon,
+                                      (OCIDateTime *)temp, &tzhr, &tzmm);
+  OCIDescriptorFree(temp, OCI_DTYPE_TIMESTAMP_TZ);
+
+  /* anything else falls back to the OCI conversion */
+  if ((rc != OCI_SUCCESS) || !tznmlen || (tznmlen >= (ub4)sizeof(tznm)))
+    return;
+  tznm[tznmlen] = '\0';
+
+  /* an offset or a UTC region, other regions may change their offset */
+  if ((tznm[0] == '+') || (tznm[0] == '-') ||
+      ((tznm[0] >= '0') && (tznm[0] <= '9')))
+    pres->fixtz_roociRes = TRUE;
+  else if (!tzhr && !tzmm)
+  {
+    for (i = 0; utcnm[i]; i++)
+      if (!strcmp((char *)tznm, utcnm[i]))
+        pres->fixtz_roociRes = TRUE;
+  }
+
+  if (pres->fixtz_roociRes)
+    pres->tzsecs_roociRes = ((double)tzhr * 3600.0) + ((double)tzmm * 60.0);
+} /* end of roociSessionTimeZone */
+
 /* ------------------------- roociWriteDateTimeData ----------------------- */
 
 sword roociWriteDateTimeData(roociRes *pres, OCIDateTime *tstm, double date)
@@ -2531,6 +4285,28 @@ sword roociResFree(roociRes *pres)
   numrows = pres->prefetch_roociRes ? 1 : pres->nrows_roociRes;
 #endif
 
+  /* no fetch may still be running into the buffers freed below */
+  roociPipeFree(pres);
+  roociBatchErrFree(pres);
+
+  /* free temporary LOBs kept in bind buffers */
+  if (pres->blen_roociRes)
+  {
+    for (bid = 0; bid < pres->bcnt_roociRes; bid++)
+      if (pres->blen_roociRes[bid])
+      {
+        OCILobLocator **lob = (OCILobLocator **)pres->bdat_roociRes[bid];
+
+        for (fcur = 0; fcur < pres->bmax_roociRes; fcur++)
+          if (pres->blen_roociRes[bid][fcur])
+            OCILobFreeTemporary(pcon->svc_roociCon, pcon->err_roociCon,
+                                lob[fcur]);
+        ROOCI_MEM_FREE(pres->blen_roociRes[bid]);
+      }
+
+    ROOCI_MEM_FREE(pres->blen_roociRes);
+  }
+
   /* free bind data buffers */
   if (pres->bdat_roociRes)
   {
@@ -2540,14 +4316,25 @@ sword roociResFree(roociRes *pres)
         /* free OCIDateTime and OCIInterval data */
         if ((pres->btyp_roociRes[bid].extyp_roociColType == 
              SQLT_TIMESTAMP_TZ) ||
+            (pres->btyp_roociRes[bid].extyp_roociColType ==
+             SQLT_TIMESTAMP_LTZ) ||
+            (pres->btyp_roociRes[bid].extyp_roociColType == SQLT_TIMESTAMP) ||
             (pres->btyp_roociRes[bid].extyp_roociColType == SQLT_INTERVAL_DS))
         {
+          ub4 dtyp =
+            (pres->btyp_roociRes[bid].extyp_roociColType ==
+                                          SQLT_TIMESTAMP_TZ) ?
+                                          OCI_DTYPE_TIMESTAMP_TZ :
+            (pres->btyp_roociRes[bid].extyp_roociColType ==
+                                          SQLT_TIMESTAMP_LTZ) ?
+                                          OCI_DTYPE_TIMESTAMP_LTZ :
+            (pres->btyp_roociRes[bid].extyp_roociColType ==
+                                          SQLT_TIMESTAMP) ?
+                                          OCI_DTYPE_TIMESTAMP :
+                                          OCI_DTYPE_INTERVAL_DS;
 #if OCI_MAJOR_VERSION > 10
           rc = OCIArrayDescriptorFree((void **)pres->bdat_roociRes[bid],
-           (pres->btyp_roociRes[bid].extyp_roociColType == 
-                                     SQLT_TIMESTAMP_TZ) ?
-                                     OCI_DTYPE_TIMESTAMP_TZ :
-                                     OCI_DTYPE_INTERVAL_DS);
+                                      dtyp);
           if (rc == OCI_ERROR)
             return rc;
 #else
@@ -2557,11 +4344,7 @@ sword roociResFree(roociRes *pres)
             void *tsdt = *(void **)(dat + fcur * (pres->bsiz_roociRes[bid]));
             if (tsdt)
             {
-              rc = OCIDescriptorFree(tsdt,
-           (pres->btyp_roociRes[bid].extyp_roociColType == 
-                                     SQLT_TIMESTAMP_TZ) ?
-                                     OCI_DTYPE_TIMESTAMP_TZ :
-                                     OCI_DTYPE_INTERVAL_DS);
+              rc = OCIDescriptorFree(tsdt, dtyp);
               if (rc != OCI_SUCCESS)
                 return rc;
             }
@@ -2884,6 +4667,28 @@ sword roociResFree(roociRes *pres)
     ROOCI_MEM_FREE(pres->lobbuf_roociRes);
   }
 
+  /* free batched LOB read buffers */
+  if (pres->lob_roociRes)
+  {
+    for (cid = 0; cid < pres->ncol_roociRes; cid++)
+    {
+      roociLob  *lob = &pres->lob_roociRes[cid];
+
+      ROOCI_MEM_FREE(lob->buf_roociLob);
+      ROOCI_MEM_FREE(lob->pos_roociLob);
+      ROOCI_MEM_FREE(lob->len_roociLob);
+      ROOCI_MEM_FREE(lob->loc_roociLob);
+      ROOCI_MEM_FREE(lob->byte_roociLob);
+      ROOCI_MEM_FREE(lob->char_roociLob);
+      ROOCI_MEM_FREE(lob->off_roociLob);
+      ROOCI_MEM_FREE(lob->bufp_roociLob);
+      ROOCI_MEM_FREE(lob->bufl_roociLob);
+      ROOCI_MEM_FREE(lob->row_roociLob);
+    }
+
+    ROOCI_MEM_FREE(pres->lob_roociRes);
+  }
+
   /* free epoch descriptor */
   if (pres->epoch_roociRes)
     OCIDescriptorFree(pres->epoch_roociRes,
@@ -2928,7 +4733,13 @@ sword roociResFree(roociRes *pres)
 
   /* free ro result */
   if (pcon)
-    pcon->res_roociCon[pres->resID_roociRes] = NULL;
+  {
+    ROOCI_MUTEX_ACQUIRE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+    if (pcon->res_roociCon &&
+        pcon->res_roociCon[pres->resID_roociRes] == pres)
+      pcon->res_roociCon[pres->resID_roociRes] = NULL;
+    ROOCI_MUTEX_RELEASE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+  }
 
   return rc;
 } /* end roociResFree */
@@ -2957,6 +4768,9 @@ static sword roociFreeObjs(roociObjType *objtyp)
 
 void *roociGetFirstParentCon(roociCtx *pctx)
 {
+  void *parent = NULL;
+
+  ROOCI_MUTEX_ACQUIRE(pctx, pctx->mtx_roociCtx);
   if (pctx->con_roociCtx)
   {
     int conID;
@@ -2971,17 +4785,22 @@ void *roociGetFirstParentCon(roociCtx *pctx)
     {
       pctx->acc_roociCtx.conID_roociConAccess = conID;
       pctx->acc_roociCtx.num_roociConAccess   = 1;
-      return (pctx->con_roociCtx[conID]->parent_roociCon);
+      parent = pctx->con_roociCtx[conID]->parent_roociCon;
     }
   }
 
-  return ((void *)NULL);
+  ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
+
+  return parent;
 } /* end roociGetFirstParentCon */
 
 /* -------------------------- roociGetNextParentCon ----------------------- */
 
 void *roociGetNextParentCon(roociCtx *pctx)
 {
+  void *parent = NULL;
+
+  ROOCI_MUTEX_ACQUIRE(pctx, pctx->mtx_roociCtx);
   if (pctx->con_roociCtx)
   {
     int conID = pctx->acc_roociCtx.conID_roociConAccess;
@@ -2996,11 +4815,13 @@ void *roociGetNextParentCon(roociCtx *pctx)
     {
       pctx->acc_roociCtx.conID_roociConAccess = conID;
       pctx->acc_roociCtx.num_roociConAccess++;
-      return (pctx->con_roociCtx[conID]->parent_roociCon);
+      parent = pctx->con_roociCtx[conID]->parent_roociCon;
     }
   }
 
-  return ((void *)NULL);
+  ROOCI_MUTEX_RELEASE(pctx, pctx->mtx_roociCtx);
+
+  return parent;
 } /* end roociGetNextParentCon */
 
 
@@ -3008,6 +4829,9 @@ void *roociGetNextParentCon(roociCtx *pctx)
 
 void *roociGetFirstParentRes(roociCon *pcon)
 {
+  void *parent = NULL;
+
+  ROOCI_MUTEX_ACQUIRE(pcon->ctx_roociCon, pcon->mtx_roociCon);
   if (pcon->res_roociCon)
   {
     int resID;
@@ -3022,17 +4846,22 @@ void *roociGetFirstParentRes(roociCon *pcon)
     {
       pcon->acc_roociCon.resID_roociResAccess = resID;
       pcon->acc_roociCon.num_roociResAccess   = 1;
-      return ((pcon->res_roociCon[resID])->parent_roociRes);
+      parent = (pcon->res_roociCon[resID])->parent_roociRes;
     }
   }
 
-  return ((void *)NULL);
+  ROOCI_MUTEX_RELEASE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+
+  return parent;
 } /* end roociGetFirstParentRes */
 
 /* -------------------------- roociGetNextParentRes ----------------------- */
 
 void *roociGetNextParentRes(roociCon *pcon)
 {
+  void *parent = NULL;
+
+  ROOCI_MUTEX_ACQUIRE(pcon->ctx_roociCon, pcon->mtx_roociCon);
   if (pcon->res_roociCon)
   {
     int resID = pcon->acc_roociCon.resID_roociResAccess;
@@ -3047,11 +4876,13 @@ void *roociGetNextParentRes(roociCon *pcon)
     {
       pcon->acc_roociCon.resID_roociResAccess = resID;
       pcon->acc_roociCon.num_roociResAccess   = 1;
-      return ((pcon->res_roociCon[resID])->parent_roociRes);
+      parent = (pcon->res_roociCon[resID])->parent_roociRes;
     }
   }
 
-  return ((void *)NULL);
+  ROOCI_MUTEX_RELEASE(pcon->ctx_roociCon, pcon->mtx_roociCon);
+
+  return parent;
 } /* end roociGetNextParentRes */
 
 /* --------------------------- roociAllocDescBindBuf ---------------------- */
@@ -4792,6 +6623,70 @@ sword roociWriteLOBData(roociRes *pres, OCILobLocator *lob_loc,
   return rc;
 } /* end of roociWriteLOBData */
 
+/* --------------------------- roociWriteLOBTemp -------------------------- */
+
+sword roociWriteLOBTemp(roociRes *pres, int bid, int row, const void *buf,
+                        int len, ub1 form)
+{
+  sword          rc    = OCI_SUCCESS;
+  roociCon      *pcon  = pres->con_roociRes;
+  OCILobLocator *lob   = ((OCILobLocator **)pres->bdat_roociRes[bid])[row];
+  ub2            etyp  = pres->btyp_roociRes[bid].extyp_roociColType;
+  oraub8         bamt  = (oraub8)len;
+  oraub8         camt  = 0;
+  oraub8         nlen;
+  oraub8        *plen;
+
+  /* lengths of the temporary LOB of each row of each bind */
+  if (!pres->blen_roociRes)
+  {
+    ROOCI_MEM_ALLOC(pres->blen_roociRes, pres->bcnt_roociRes,
+                    sizeof(oraub8 *));
+    if (!pres->blen_roociRes)
+      return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+  if (!pres->blen_roociRes[bid])
+  {
+    ROOCI_MEM_ALLOC(pres->blen_roociRes[bid], pres->bmax_roociRes,
+                    sizeof(oraub8));
+    if (!pres->blen_roociRes[bid])
+      return ROOCI_DRV_ERR_MEM_FAIL;
+  }
+  plen = &pres->blen_roociRes[bid][row];
+
+  /* a row creates its temporary LOB once, later chunks overwrite it */
+  if (!*plen)
+  {
+    rc = OCILobCreateTemporary(pcon->svc_roociCon, pcon->err_roociCon, lob,
+                               (ub2)OCI_DEFAULT, form,
+                               (etyp == SQLT_CLOB) ? OCI_TEMP_CLOB :
+                                                     OCI_TEMP_BLOB,
+                               FALSE, OCI_DURATION_SESSION);
+    if (rc == OCI_ERROR)
+      return rc;
+  }
+
+  rc = OCILobWrite2(pcon->svc_roociCon, pcon->err_roociCon, lob,
+                    &bamt, (etyp == SQLT_CLOB) ? &camt : (oraub8 *)0, 1,
+                    (void *)buf, (oraub8)len, OCI_ONE_PIECE, NULL,
+                    (OCICallbackLobWrite2)0, 0, form);
+  if (rc == OCI_ERROR)
+    return rc;
+
+  /* a shorter value drops the tail left by the value before, the length
+     of a CLOB is in characters */
+  nlen = (etyp == SQLT_CLOB) ? camt : bamt;
+  if (*plen > nlen)
+  {
+    rc = OCILobTrim2(pcon->svc_roociCon, pcon->err_roociCon, lob, nlen);
+    if (rc == OCI_ERROR)
+      return rc;
+  }
+  *plen = nlen ? nlen : 1;
+
+  return rc;
+} /* end of roociWriteLOBTemp */
+
 /* -------------------------- roociWriteBLOBData --------------------------- */
 
 sword roociWriteBLOBData(roociRes *pres, OCILobLocator *lob_loc,
@@ -11,6 +11,28 @@
    NOTES
 
    MODIFIED   (MM/DD/YY)
+   rpingte     10/18/26 - add ROOCI_MEM_REALLOC
+   rpingte     10/18/26 - add roociClock
+   rpingte     10/18/26 - keep credentials only when asked
+   rpingte     10/18/26 - add roociStmtRun, roociThrCreate, roociThrJoin and
+                          roociSleep
+   rpingte     10/18/26 - add mutexes of connection and result vectors
+   rpingte     10/18/26 - add DRCP connection class, purity and release mode
+   rpingte     10/18/26 - add session pool
+   rpingte     10/18/26 - keep last bind of each position
+   rpingte     10/18/26 - reuse temporary LOBs of binds
+   rpingte     10/18/26 - write DATE and TIMESTAMP binds in C
+   rpingte     10/18/26 - add threaded context and credentials of connection
+   rpingte     10/18/26 - add batch errors of array DML
+   rpingte     10/18/26 - add direct path load
+   rpingte     10/18/26 - execute bind chunks in background
+   rpingte     10/18/26 - add bind buffer capacity for packed strings
+   rpingte     10/17/26 - bind at a caller supplied buffer
+   rpingte     10/17/26 - read LOBs of a fetched batch in one call
+   rpingte     10/17/26 - add fetch buffer budget for bulk_read auto
+   rpingte     10/17/26 - add background fetch pipeline
+   rpingte     10/17/26 - add native DATE and TIMESTAMP(0) decoding
+   rpingte     10/17/26 - add roociResDefineAt
    rpingte     10/17/25 - change __FUNCTION__ to __func__
    rpingte     05/05/25 - add sparse support via Matrix library
    rpingte     04/25/25 - Bug 37777349: support data longer than 32767 in bind to CLOB
@@ -134,6 +156,39 @@
   while (0)
 #endif
 
+/* macro for growing memory, new_ is NULL and buf_ kept when it fails */
+#ifdef ROOCI_MEM_DEBUG
+/* Intentionally left in one line to get the exact line number */
+# define ROOCI_MEM_REALLOC(new_, buf_, no_of_elem, siz_of_elem) \
+  (new_) = realloc((buf_), (size_t)(no_of_elem) * (siz_of_elem)); fprintf(stdout, "%p reallocated to %p in %s at line# %d\n", (void *)(buf_), (void *)(new_), __func__, __LINE__);
+#else
+# define ROOCI_MEM_REALLOC(new_, buf_, no_of_elem, siz_of_elem) \
+  do \
+  { \
+    (new_) = realloc((buf_), (size_t)(no_of_elem) * (siz_of_elem)); \
+  } \
+  while (0)
+#endif
+
+/* acquire and release a MUTEX of a threaded context, no-op otherwise */
+#define ROOCI_MUTEX_ACQUIRE(pctx_, mtx_)                                \
+  do                                                                    \
+  {                                                                     \
+    if (mtx_)                                                           \
+      OCIThreadMutexAcquire((pctx_)->env_roociCtx,                      \
+                            (pctx_)->lerr_roociCtx, (mtx_));            \
+  }                                                                     \
+  while (0)
+
+#define ROOCI_MUTEX_RELEASE(pctx_, mtx_)                                \
+  do                                                                    \
+  {                                                                     \
+    if (mtx_)                                                           \
+      OCIThreadMutexRelease((pctx_)->env_roociCtx,                      \
+                            (pctx_)->lerr_roociCtx, (mtx_));            \
+  }                                                                     \
+  while (0)
+
 /* macro to free memory */
 #ifdef ROOCI_MEM_DEBUG
 /* Intentionally left in one line to get the exact line number */
@@ -172,9 +227,16 @@ do { \
 */
 #define ROOCI_DATE_TIME_STR_LEN 30
 
+/* most rows fetched at a time when sized from a byte budget */
+#define ROOCI_BULK_READ_MAX     32768
+
+/* length of DATE in the 7 byte format of SQLT_DAT */
+#define ROOCI_DATE_LEN          7
+
 /* forward declarations */
 struct roociCon;
 struct roociRes;
+struct roociPool;
 
 /* Conn access structure for traversing list of connections using first/next */
 struct roociConAccess
@@ -196,7 +258,10 @@ struct roociCtx
   roociloadVersion  ver_roociCtx;
   boolean           control_c_roociCtx;     /* Handle control C interrupt ? */
   roociConAccess    acc_roociCtx;    /* sequential traversal of connections */
-  /* TODO: add mutex when R is thread-safe */
+  struct roociPool *pool_roociCtx;                 /* list of session POOLs */
+  boolean           threaded_roociCtx;          /* OCI_THREADED environment */
+  OCIError         *lerr_roociCtx;                 /* ERRor handle of Locks */
+  OCIThreadMutex   *mtx_roociCtx;             /* MuTeX of connection vector */
 
   /* extproc environment fields */
   boolean           extproc_roociCtx;            /* EXTPROC environment flag */
@@ -217,6 +282,26 @@ struct roociResAccess
 };
 typedef struct roociResAccess roociResAccess;
 
+/* session POOL OCI context */
+struct roociPool
+{
+  void              *parent_roociPool;             /* parent pool reference */
+  roociCtx          *ctx_roociPool;                         /* rooci DRiVer */
+  OCIError          *err_roociPool;                         /* ERRor handle */
+  OCISPool          *spool_roociPool;                /* Session POOL handle */
+  OCIAuthInfo       *auth_roociPool;               /* AUThentication handle */
+  OraText           *name_roociPool;                           /* pool NAME */
+  ub4                namsz_roociPool;                /* length of pool name */
+  char              *cstr_roociPool;                      /* Connect STRing */
+  ub4                min_roociPool;           /* MINimum number of sessions */
+  ub4                max_roociPool;           /* MAXimum number of sessions */
+  ub4                incr_roociPool;           /* sessions opened at a time */
+  ub4                scache_roociPool;              /* Statement CACHE size */
+  int                ncon_roociPool;      /* Number of CONnections acquired */
+  struct roociPool  *next_roociPool;                 /* NEXT pool of driver */
+};
+typedef struct roociPool roociPool;
+
 /* CONnection OCI context */
 struct roociCon
 {
@@ -231,13 +316,20 @@ struct roociCon
   int                max_roociCon;             /* MAXimum number of results */
   int                tot_roociCon;     /* TOTal number of results processed */
   char              *cstr_roociCon;                       /* Connect STRing */
+  char              *user_roociCon;                            /* USER name */
+  char              *pass_roociCon;                             /* PASSword */
+  ub4                mode_roociCon;        /* session MODE of OCISessionGet */
+  roociPool         *pool_roociCon;           /* session POOL of connection */
+  char              *cclass_roociCon;              /* DRCP Connection CLASS */
+  ub4                purity_roociCon;                /* DRCP session PURITY */
+  ub4                rlsmode_roociCon; /* ReLeaSe MODE of OCISessionRelease */
   int                conID_roociCon;                       /* connection ID */
   boolean            timesten_rociCon;          /* TIMESTEN connection flag */
   double             secs_UTC_roociCon;     /* LocalTZ, UTC diff in seconds
                     * used for timesten as TSTZ and TSLTZ are not supported */
   sb4                nlsmaxwidth_roociCon;    /* NLS max width of character */
   roociResAccess     acc_roociCon;       /* sequential traversal of results */
-  /* TODO: add mutex when R is thread-safe */
+  OCIThreadMutex    *mtx_roociCon;                /* MuTeX of result vector */
 };
 typedef struct roociCon roociCon;
 
@@ -298,8 +390,97 @@ struct roociColType
 #define ROOCI_COL_VEC_AS_CLOB 0x00000001    /* vector bound as CLOB(STRSXP) */
 #define ROOCI_COL_PLS_AS_CLOB 0x00000002  /* PLSQL IN param as CLOB(STRSXP) */
 #define ROOCI_COL_PLS_AS_BLOB 0x00000004  /* PLSQL IN param as BLOB(RAWSXP) */
+#define ROOCI_COL_STR_PACK    0x00000008   /* STRSXP bind sized per chunk */
+#define ROOCI_COL_LOB_DATA    0x00000010    /* LOB bound as LVC or LVB data */
+  size_t         bcap_roociColType;      /* bytes allocated for bind buffer */
+  void          *lbuf_roociColType;             /* data buffer of last bind */
+  sb2           *lind_roociColType;              /* indicators of last bind */
+  ub2           *llen_roociColType;                 /* lengths of last bind */
+  sb4            lsiz_roociColType;             /* buffer size of last bind */
+  ub2            ltyp_roociColType;           /* external type of last bind */
+  ub1            lfrm_roociColType;             /* form of use of last bind */
 };
 
+/* context of a statement executed in an OCI thread */
+struct roociThrCtx
+{
+  roociCon         *pcon_roociThrCtx;   /* Pointer to the current conection */
+  struct roociRes  *pres_roociThrCtx;              /* pointer to result set */
+  ub4               nrows_roociThrCtx;
+  sword             rc_roociThrCtx;
+  ub4              *aff_rows_roociThrCtx; /* Number of rows affected by cmd */
+  ub2               styp_roociThrCtx;                     /* Statement type */
+  OCIThreadId      *tid_roociThrCtx;                       /* OCI Thread ID */
+  OCIThreadHandle  *thdhp_roociThrCtx;                     /* thread handle */
+  boolean           bExecOver_roociThrCtx;           /* OCIStmtExecute done */
+};
+typedef struct roociThrCtx roociThrCtx;
+
+/* fetch PIPEline states */
+#define ROOCI_PIPE_IDLE       0                  /* no batch fetched ahead */
+#define ROOCI_PIPE_BUSY       1          /* thread fetching the next batch */
+#define ROOCI_PIPE_READY      2           /* next batch fetched and waiting */
+
+/* array DML errors of a result */
+struct roociBatchErr
+{
+  ub4              cnt_roociBatchErr;                /* CouNT of row errors */
+  ub4              max_roociBatchErr;           /* room in the arrays below */
+  ub4             *row_roociBatchErr;        /* failed ROW offsets, 0 based */
+  sb4             *code_roociBatchErr;                  /* ORA- error CODEs */
+  char           **msg_roociBatchErr;                     /* error MeSsaGes */
+  OCIError        *err_roociBatchErr;        /* ERRor handle of a row error */
+};
+typedef struct roociBatchErr roociBatchErr;
+
+/* background fetch PIPEline of a result */
+struct roociPipe
+{
+  void           **dat_roociPipe;                     /* spare DATa buffers */
+  sb2            **ind_roociPipe;                /* spare INDicator buffers */
+  ub2            **len_roociPipe;                   /* spare LENgth buffers */
+  OCIThreadId     *tid_roociPipe;                          /* OCI Thread ID */
+  OCIThreadHandle *thd_roociPipe;                          /* thread handle */
+  ub1              state_roociPipe;                       /* pipeline STATE */
+  sword            rc_roociPipe;                /* Return Code of the fetch */
+  ub4              rows_roociPipe;                /* number of ROWS fetched */
+  boolean          eof_roociPipe;                 /* TRUE - End Of Fetch */
+  roociThrCtx      exec_roociPipe;    /* background EXECute of a bind chunk */
+  void           **bdat_roociPipe;               /* spare Bind DATa buffers */
+  sb2            **bind_roociPipe;          /* spare Bind INDicator buffers */
+  ub2            **alen_roociPipe;             /* spare Bind LENgth buffers */
+  size_t          *bcap_roociPipe;   /* CAPacity of spare bind data buffers */
+};
+typedef struct roociPipe roociPipe;
+
+/* LOBs of a fetched batch read together with OCILobArrayRead */
+struct roociLob
+{
+  ub1             *buf_roociLob;                /* data of all LOBs in batch */
+  oraub8           bufsz_roociLob;                /* size of LOB data BUFfer */
+  oraub8          *pos_roociLob;     /* POSition of each row's LOB in buffer */
+  sb8             *len_roociLob;    /* LENgth of each row's LOB, -1 - unread */
+  OCILobLocator  **loc_roociLob;                     /* LOCators of the read */
+  oraub8          *byte_roociLob;                /* BYTE amounts of the read */
+  oraub8          *char_roociLob;               /* CHARacter amounts of read */
+  oraub8          *off_roociLob;                      /* OFFsets of the read */
+  void           **bufp_roociLob;                     /* BUFfers of the read */
+  oraub8          *bufl_roociLob;              /* BUFfer Lengths of the read */
+  int             *row_roociLob;                 /* fetched ROW of each read */
+};
+typedef struct roociLob roociLob;
+
+/* direct path LOAD of a table */
+struct roociDirPath
+{
+  OCIDirPathCtx      *ctx_roociDirPath;              /* direct path ConTeXt */
+  OCIDirPathColArray *ca_roociDirPath;                      /* Column Array */
+  OCIDirPathStream   *str_roociDirPath;                           /* STReam */
+  ub4                 nrows_roociDirPath; /* number of ROWS in column array */
+  ub2                 ncol_roociDirPath;               /* number of COLumns */
+};
+typedef struct roociDirPath roociDirPath;
+
 /* RESult OCI context */
 struct roociRes
 {
@@ -318,6 +499,7 @@ struct roociRes
   sb4             *bsiz_roociRes;              /* Bind buffer maximum SIZes */
   roociColType    *btyp_roociRes;                      /* Bind buffer TYPes */
   int             *bform_roociRes;    /* character set form for PL/SQL bind */
+  oraub8         **blen_roociRes;              /* temp LOB LENgth, 0 - none */
   /* ------------------------------- DEFINE ------------------------------- */
   int              ncol_roociRes;                      /* Number of COLumns */
   roociColType    *typ_roociRes;                          /* internal TYPes */
@@ -331,10 +513,16 @@ struct roociRes
   boolean          nocache_roociRes;   /* TRUE - do not cache result in mem */
   boolean          prefetch_roociRes;    /* TRUE - use OCI prefetch buffers */
   int              nrows_roociRes;     /* number of rows to fetch at a time */
+  double           fbytes_roociRes;  /* Fetch buffer BYTES, 0 - fixed nrows */
   int              nrows_write_roociRes; /* # of elements to bind at a time */
   OCIDateTime     *epoch_roociRes;             /* epoch from 1970/01/01 UTC */
   OCIInterval     *diff_roociRes; /* time interval difference from 1970 UTC */
   OCIDateTime     *tsdes_roociRes;  /* temp descriptor to convert date type */
+  boolean          fixtz_roociRes;  /* TRUE - session time zone is an offset */
+  double           tzsecs_roociRes;   /* session time zone offset in seconds */
+  roociPipe       *pipe_roociRes;   /* background fetch PIPEline, NULL - off */
+  roociLob        *lob_roociRes;     /* batched LOB reads per column or NULL */
+  roociBatchErr   *berr_roociRes;           /* array DML errors, NULL - off */
   OCIStmt        **stm_cur_roociRes;   /* statement handle buffer which are */
                                               /* bound to each plsql cursor */
   OCIStmt         *curstm_roociRes;    /* statement handle based on whether */
@@ -351,7 +539,7 @@ struct roociRes
                                       /* some other package is used instead */
                                       /* ROracle will construct index array */
                                       /* in this case for noon-zero elements*/
-  /* TODO: add mutex when R is thread-safe */
+  /* used by one thread at a time, see rodbiConWait */
 };
 typedef struct roociRes roociRes;
 
@@ -363,13 +551,35 @@ typedef struct roociRes roociRes;
 /* ----------------------------- roociInitializeCtx ----------------------- */
 /* Intialize driver oci context */
 sword roociInitializeCtx (roociCtx *pctx, void *epx, boolean interrupt_srv,
-                          boolean unicode_as_utf8, boolean ora_objects);
+                          boolean unicode_as_utf8, boolean ora_objects,
+                          boolean threaded);
 
 /* ----------------------------- roociInitializeCon ----------------------- */
 /* Initialize connection oci context */
 sword roociInitializeCon(roociCtx *pctx, roociCon *pcon,
                          char *user, char *pass, char *cstr,
-                         ub4 stmt_cache_siz, ub4 session_mode);
+                         ub4 stmt_cache_siz, ub4 session_mode,
+                         char *cclass, ub4 purity, roociPool *ppool,
+                         boolean keep_auth);
+
+/* ----------------------------- roociInitializePool ---------------------- */
+/* Create session pool of the driver */
+sword roociInitializePool(roociCtx *pctx, roociPool *ppool,
+                          char *user, char *pass, char *cstr,
+                          ub4 min, ub4 max, ub4 incr, ub4 stmt_cache_siz);
+
+/* ----------------------------- roociGetPoolInfo ------------------------- */
+/* Retrieve number of open and busy sessions of pool */
+sword roociGetPoolInfo(roociPool *ppool, ub4 *open, ub4 *busy);
+
+/* ----------------------------- roociGetPoolError ------------------------ */
+/* Retrieve error message of pool */
+sword roociGetPoolError(roociPool *ppool, sb4 *errNum, text *errMsg,
+                        ub4 errMsgSize);
+
+/* ----------------------------- roociTerminatePool ----------------------- */
+/* Destroy session pool */
+sword roociTerminatePool(roociPool *ppool);
 
 /* ----------------------------- roociGetError ---------------------------- */
 /* Retrieve error message and and error number */
@@ -405,6 +615,31 @@ sword roociCommitCon(roociCon *pcon);
 /* roll back connection transaction */
 sword roociRollbackCon(roociCon *pcon);
 
+/* -------------------------- roociDirPathInit ---------------------------- */
+/* Prepare a table for direct path load of the given columns */
+sword roociDirPathInit(roociCon *pcon, roociDirPath *pdp, const char *schema,
+                       const char *table, ub2 ncol, const char **names,
+                       const ub2 *types, const ub4 *sizes, const ub2 *csids,
+                       ub4 nrows);
+
+/* -------------------------- roociDirPathSet ----------------------------- */
+/* Point a column array entry at the caller's data */
+sword roociDirPathSet(roociCon *pcon, roociDirPath *pdp, ub4 row, ub2 col,
+                      ub1 *dat, ub4 len, ub1 flg);
+
+/* -------------------------- roociDirPathLoad ---------------------------- */
+/* Convert the column array to streams and load them */
+sword roociDirPathLoad(roociCon *pcon, roociDirPath *pdp, ub4 rows,
+                       ub4 *done);
+
+/* -------------------------- roociDirPathFinish -------------------------- */
+/* Finish a direct path load */
+sword roociDirPathFinish(roociCon *pcon, roociDirPath *pdp);
+
+/* -------------------------- roociDirPathFree ---------------------------- */
+/* Free direct path handles, aborting an unfinished load */
+void roociDirPathFree(roociCon *pcon, roociDirPath *pdp, boolean abort);
+
 /* ----------------------------- roociInitializeRes ----------------------- */
 /* Initialize result set oci context */
 sword roociInitializeRes(roociCon *pcon, roociRes *pres, text *qry, int qrylen,
@@ -421,15 +656,108 @@ sword roociExecTTOpt(roociCon *pcon);
 sword roociStmtExec(roociRes *pres, ub4 noOfRows, ub2 styp, 
                     int *rows_affected);
 
+/* ------------------------------ roociStmtRun ---------------------------- */
+/* Execute statement like roociStmtExec in the calling thread, no interrupt
+   check */
+sword roociStmtRun(roociRes *pres, ub4 noOfRows, ub2 styp, int *rows_affected);
+
 /* ----------------------------- roociBindData ---------------------------- */
-/* Bind input data for statement execution */
-sword roociBindData(roociRes *pres, ub4 bufPos, ub1 form_of_use, 
+/* Bind input data for statement execution, NULL dat - own bind buffer */
+sword roociBindData(roociRes *pres, ub4 bufPos, void *dat, ub1 form_of_use, 
                     const char *name);
 
 /* ----------------------------- roociResDefine --------------------------- */
 /* Allocate memory and define ouput buffer */
 sword roociResDefine(roociRes *pres);
 
+/* ---------------------------- roociResDefineAt -------------------------- */
+/* Re-define a plain buffer column at caller supplied ouput buffers */
+sword roociResDefineAt(roociRes *pres, int cid, void *dat, sb2 *ind,
+                       ub2 *len);
+
+/* ----------------------------- roociPipeInit ---------------------------- */
+/* Allocate spare define buffers to fetch in background */
+sword roociPipeInit(roociRes *pres);
+
+/* ---------------------------- roociPipeFetch ---------------------------- */
+/* Take the batch fetched ahead and start fetching the next one */
+sword roociPipeFetch(roociRes *pres, ub4 *rows_fetched, boolean *end_of_fetch);
+
+/* ----------------------------- roociPipeWait ---------------------------- */
+/* Wait for the background fetch, optionally breaking it */
+void roociPipeWait(roociRes *pres, boolean cancel);
+
+/* --------------------------- roociPipeBindInit -------------------------- */
+/* Allocate spare bind buffers to execute in background */
+sword roociPipeBindInit(roociRes *pres);
+
+/* --------------------------- roociPipeBindSwap -------------------------- */
+/* Exchange bind buffers with the spare ones */
+void roociPipeBindSwap(roociRes *pres);
+
+/* --------------------------- roociPipeBindFree -------------------------- */
+/* Free spare bind buffers, they are allocated again for a new size */
+void roociPipeBindFree(roociRes *pres);
+
+/* -------------------------- roociPipeExecStart -------------------------- */
+/* Start executing the bound chunk in background */
+sword roociPipeExecStart(roociRes *pres, ub4 noOfRows, ub2 styp);
+
+/* -------------------------- roociPipeExecWait --------------------------- */
+/* Wait for the background execute and get its result */
+sword roociPipeExecWait(roociRes *pres, int *rows_affected);
+
+/* --------------------------- roociThrExecStart -------------------------- */
+/* Execute the statement in a new thread, rows gets the rows affected */
+sword roociThrExecStart(roociThrCtx *thr, roociRes *pres, ub4 noOfRows,
+                        ub2 styp, ub4 *rows);
+
+/* --------------------------- roociThrExecWait --------------------------- */
+/* Wait for the execute started by roociThrExecStart and get its result */
+sword roociThrExecWait(roociThrCtx *thr);
+
+/* ----------------------------- roociThrCreate --------------------------- */
+/* Run fn(arg) in a new thread, on failure no thread is left to join */
+sword roociThrCreate(roociCon *pcon, void (*fn)(void *), void *arg,
+                     OCIThreadId **tid, OCIThreadHandle **thd);
+
+/* ------------------------------ roociThrJoin ---------------------------- */
+/* Wait for a thread of roociThrCreate, optionally breaking its call */
+void roociThrJoin(roociCon *pcon, OCIThreadId **tid, OCIThreadHandle **thd,
+                  boolean cancel);
+
+/* ------------------------------- roociSleep ----------------------------- */
+/* Suspend the calling thread for msec milliseconds */
+void roociSleep(ub4 msec);
+
+/* ------------------------------- roociClock ----------------------------- */
+/* Milliseconds of a monotonic clock, for measuring elapsed time */
+double roociClock(void);
+
+/* --------------------------- roociStmtRowCount -------------------------- */
+/* Get rows processed by the last execute */
+sword roociStmtRowCount(roociRes *pres, ub4 *rows);
+
+/* --------------------------- roociBatchErrInit -------------------------- */
+/* Execute array DML with OCI_BATCH_ERRORS */
+sword roociBatchErrInit(roociRes *pres);
+
+/* --------------------------- roociBatchErrGet --------------------------- */
+/* Add the row errors of the last execute, rows offset by base */
+sword roociBatchErrGet(roociRes *pres, ub4 base);
+
+/* --------------------------- roociBatchErrReset ------------------------- */
+/* Forget the row errors collected so far */
+void roociBatchErrReset(roociRes *pres);
+
+/* --------------------------- roociBatchErrFree -------------------------- */
+/* Free the row errors and turn batch errors off */
+void roociBatchErrFree(roociRes *pres);
+
+/* ----------------------------- roociPipeFree ---------------------------- */
+/* Stop the background fetch and free spare define buffers */
+void roociPipeFree(roociRes *pres);
+
 /* ----------------------------- roociDescCol ----------------------------- */
 /* Desribe result set coulmn properties */
 sword roociDescCol(roociRes *pres, ub4 colId, ub2 *extTyp, oratext **colName, 
@@ -475,11 +803,21 @@ sword roociReadLOBData(roociRes *pres, OCILobLocator *lob_loc, int *lob_len,
 sword roociReadBLOBData(roociRes *pres, OCILobLocator *lob_loc, int *lob_len,
                         ub1 form, ub2 exttyp);
 
+/* ------------------------------ roociReadLOBCell ------------------------ */
+/* Read LOB data of a fetched row, from the batch read when possible */
+sword roociReadLOBCell(roociRes *pres, int cid, int row, ub1 **lob_dat,
+                       int *lob_len);
+
 /* -------------------------- rociReadDateTimeData ------------------------- */
 /* Read DateTime data */
 sword roociReadDateTimeData(roociRes *pres, OCIDateTime *tstm, double *date,
                             boolean isDate);
 
+/* ----------------------------- roociReadDateData ------------------------- */
+/* Read array of 7 byte DATE data */
+void roociReadDateData(roociRes *pres, const ub1 *dat, sb4 siz,
+                       const sb2 *ind, int cnt, double *date);
+
 
 /* ---------------------------- roociReadUDTData --------------------------- */
 /* Read UDT data */
@@ -498,6 +836,25 @@ sword roociReadVectorData(roociRes *pres, OCIVector *vecdp, SEXP *lst,
 /* Write DateTime data */
 sword roociWriteDateTimeData(roociRes *pres, OCIDateTime *tstm, double date);
 
+/* ---------------------------- roociDateFits ------------------------------ */
+/* TRUE if all dates are whole seconds within the range of DATE */
+boolean roociDateFits(roociRes *pres, const double *date, int cnt);
+
+/* ---------------------------- roociWriteDateData ------------------------- */
+/* Write array of 7 byte DATE data */
+void roociWriteDateData(roociRes *pres, const double *date, int cnt,
+                        ub1 *dat, sb2 *ind, ub2 *alen);
+
+/* ------------------------- roociWriteTimestampData ----------------------- */
+/* Write array of TIMESTAMP data without time zone */
+sword roociWriteTimestampData(roociRes *pres, OCIDateTime **tstm,
+                              const double *date, int cnt, sb2 *ind,
+                              ub2 *alen);
+
+/* -------------------------- roociSessionTimeZone ------------------------- */
+/* Get the session time zone offset, if it is fixed */
+void roociSessionTimeZone(roociRes *pres);
+
 /* -------------------------- rociReadDiffTimeData ------------------------- */
 /* Read DiffTime data */
 sword roociReadDiffTimeData(roociRes *pres, OCIInterval *tstm, double *time);
@@ -522,6 +879,11 @@ sword roociWriteBLOBData(roociRes *pres, OCILobLocator *lob_loc,
 sword roociWriteLOBData(roociRes *pres, OCILobLocator *lob_loc,
                         const oratext *lob_buf, int lob_len, ub1 form);
 
+/* --------------------------- roociWriteLOBTemp --------------------------- */
+/* Write LOB data into the temporary LOB kept in a row of a bind buffer */
+sword roociWriteLOBTemp(roociRes *pres, int bid, int row, const void *buf,
+                        int len, ub1 form);
+
 #if (OCI_MAJOR_VERSION == 23 && OCI_MINOR_VERSION > 3) || (OCI_MAJOR_VERSION > 23)
 /* --------------------------- roociWriteVectorData --------------------------- */
 /* Write Vector data */
@@ -20,6 +20,13 @@
    NOTES
 
    MODIFIED   (MM/DD/YY)
+   rpingte     10/18/26 - add OCIThreadMutex functions
+   rpingte     10/18/26 - add OCISessionPoolCreate and OCISessionPoolDestroy
+   rpingte     10/18/26 - add OCIDirPath functions for direct path load
+   rpingte     10/17/26 - add OCILobArrayRead
+   rpingte     10/17/26 - add OCIThreadClose, OCIThreadHndDestroy and
+                          OCIThreadIdDestroy
+   rpingte     10/17/26 - add OCIDateTimeGetTimeZoneName
    rpingte     10/17/25 - change __FUNCTION__ to __func__
    rpingte     09/01/24 - fix debug printf
    rpingte     07/11/24 - fix compiler warnigs with pre-19c clients
@@ -288,6 +295,8 @@ typedef sword (*roociloadFnType__dateTimeGetDate)(void *hndl, OCIError *err,
         const OCIDateTime *datetime, sb2 *year, ub1 *month, ub1 *day);
 typedef sword (*roociloadFnType__dateTimeGetTime)(void *hndl, OCIError *err,
         OCIDateTime *datetime, ub1 *hour, ub1 *min, ub1 *sec, ub4 *fsec);
+typedef sword (*roociloadFnType__dateTimeGetTimeZoneName)(void *hndl,
+        OCIError *err, const OCIDateTime *datetime, ub1 *buf, ub4 *buflen);
 typedef sword (*roociloadFnType__dateTimeGetTimeZoneOffset)(void *hndl,
         OCIError *err, const OCIDateTime *datetime, sb1 *hour, sb1 *minute);
 typedef sword (*roociloadFnType__dateTimeIntervalAdd)(void *hndl,
@@ -312,6 +321,24 @@ typedef sword (*roociloadFnType__descriptorAlloc)(const void *parenth,
         void **descpp, const ub4 type, const size_t xtramem_sz,
         void **usrmempp);
 typedef sword (*roociloadFnType__descriptorFree)(void *descp, const ub4 type);
+typedef sword (*roociloadFnType__dirPathAbort)(OCIDirPathCtx *dpctx,
+        OCIError *errhp);
+typedef sword (*roociloadFnType__dirPathColArrayEntrySet)(
+        OCIDirPathColArray *dpca, OCIError *errhp, ub4 rownum, ub2 colIdx,
+        ub1 *cvalp, ub4 clen, ub1 cflg);
+typedef sword (*roociloadFnType__dirPathColArrayReset)(
+        OCIDirPathColArray *dpca, OCIError *errhp);
+typedef sword (*roociloadFnType__dirPathColArrayToStream)(
+        OCIDirPathColArray *dpca, OCIDirPathCtx *dpctx,
+        OCIDirPathStream *dpstr, OCIError *errhp, ub4 rowcnt, ub4 rowoff);
+typedef sword (*roociloadFnType__dirPathFinish)(OCIDirPathCtx *dpctx,
+        OCIError *errhp);
+typedef sword (*roociloadFnType__dirPathLoadStream)(OCIDirPathCtx *dpctx,
+        OCIDirPathStream *dpstr, OCIError *errhp);
+typedef sword (*roociloadFnType__dirPathPrepare)(OCIDirPathCtx *dpctx,
+        OCISvcCtx *svchp, OCIError *errhp);
+typedef sword (*roociloadFnType__dirPathStreamReset)(OCIDirPathStream *dpstr,
+        OCIError *errhp);
 typedef sword (*roociloadFnType__envCreate)(OCIEnv **envp,
         ub4 mode, void *ctxp,
         void    *(*malocfp)(void  *ctxp, size_t size),
@@ -348,6 +375,11 @@ typedef sword (*roociloadFnType__interCreate)(OCIEnv *env,
         OCIError *err, const OCIColl *coll, OCIIter **itr);
 typedef sword (*roociloadFnType__lobClose)(OCISvcCtx *svchp,
         OCIError *errhp, OCILobLocator *locp);
+typedef sword (*roociloadFnType__lobArrayRead)(OCISvcCtx *svchp,
+        OCIError *errhp, ub4 *array_iter, OCILobLocator **lobp_arr,
+        oraub8 *byte_amt_arr, oraub8 *char_amt_arr, oraub8 *offset_arr,
+        void **bufp_arr, oraub8 *bufl_arr, ub1 piece, void *ctxp,
+        OCICallbackLobArrayRead cbfp, ub2 csid, ub1 csfrm);
 typedef sword (*roociloadFnType__lobCreateTemporary)(OCISvcCtx *svchp,
         OCIError *errhp, OCILobLocator *locp, ub2 csid, ub1 csfrm,
         ub1 lobtype, boolean cache, OCIDuration duration);
@@ -457,7 +489,12 @@ typedef sword (*roociloadFnType__sessionGet)(OCIEnv *envhp, OCIError *errhp,
         OCISvcCtx **svchp, OCIAuthInfo *sechp, OraText *poolName,
         ub4 poolNameLen, const OraText *tagInfo, ub4 tagInfoLen,
         OraText **retTagInfo, ub4 *retTagInfoLen, boolean *found, ub4 mode);
-typedef sword (*roociloadFnType__sessionPoolDestroy)(OCICPool *poolhp,
+typedef sword (*roociloadFnType__sessionPoolCreate)(OCIEnv *envhp,
+        OCIError *errhp, OCISPool *spoolhp, OraText **poolName,
+        ub4 *poolNameLen, const OraText *connStr, ub4 connStrLen,
+        ub4 sessMin, ub4 sessMax, ub4 sessIncr, OraText *userid,
+        ub4 useridLen, OraText *password, ub4 passwordLen, ub4 mode);
+typedef sword (*roociloadFnType__sessionPoolDestroy)(OCISPool *spoolhp,
         OCIError *errhp, ub4 mode);
 typedef sword (*roociloadFnType__sessionRelease)(OCISvcCtx *svchp,
         OCIError *errhp, OraText *tag, ub4 tagLen, ub4 mode);
@@ -483,15 +520,29 @@ typedef sword (*roociloadFnType__tableFirst)(OCIEnv *env, OCIError *err,
         const OCITable *tbl, sb4 *index);
 typedef sword (*roociloadFnType__tableNext)(OCIEnv *env, OCIError *err,
         sb4 index, const OCITable *tbl, sb4 *next_index, boolean *exists);
+typedef sword (*roociloadFnType__threadClose)(void *hndl, OCIError *err,
+        OCIThreadHandle *tHnd);
 typedef sword (*roociloadFnType__threadCreate)(void *hndl, OCIError *err,
         void (*start)(void  *), void  *arg, OCIThreadId *tid,
         OCIThreadHandle *tHnd);
+typedef sword (*roociloadFnType__threadHndDestroy)(void *hndl,
+        OCIError *err, OCIThreadHandle **tHnd);
 typedef sword (*roociloadFnType__threadHndInit)(void *hndl,
         OCIError *err, OCIThreadHandle **tHnd);
+typedef sword (*roociloadFnType__threadIdDestroy)(void *hndl,
+        OCIError *err, OCIThreadId **tid);
 typedef sword (*roociloadFnType__threadIdInit)(void *hndl,
         OCIError *err, OCIThreadId **tid);
 typedef sword (*roociloadFnType__threadJoin)(void *hndl,
         OCIError *err, OCIThreadHandle *tHnd);
+typedef sword (*roociloadFnType__threadMutexAcquire)(void *hndl,
+        OCIError *err, OCIThreadMutex *mutex);
+typedef sword (*roociloadFnType__threadMutexDestroy)(void *hndl,
+        OCIError *err, OCIThreadMutex **mutex);
+typedef sword (*roociloadFnType__threadMutexInit)(void *hndl,
+        OCIError *err, OCIThreadMutex **mutex);
+typedef sword (*roociloadFnType__threadMutexRelease)(void *hndl,
+        OCIError *err, OCIThreadMutex *mutex);
 typedef sword (*roociloadFnType__transCommit)(OCISvcCtx *svchp,
         OCIError *errhp, ub4 flags);
 typedef sword (*roociloadFnType__transRollback)(OCISvcCtx *svchp,
@@ -582,6 +633,7 @@ struct roociloadSymbols
   roociloadFnType__dateTimeConstruct fnDateTimeConstruct;
   roociloadFnType__dateTimeGetDate fnDateTimeGetDate;
   roociloadFnType__dateTimeGetTime fnDateTimeGetTime;
+  roociloadFnType__dateTimeGetTimeZoneName fnDateTimeGetTimeZoneName;
   roociloadFnType__dateTimeGetTimeZoneOffset fnDateTimeGetTimeZoneOffset;
   roociloadFnType__dateTimeIntervalAdd fnDateTimeIntervalAdd;
   roociloadFnType__dateTimeSubtract fnDateTimeSubtract;
@@ -591,6 +643,14 @@ struct roociloadSymbols
   roociloadFnType__describeAny fnDescribeAny;
   roociloadFnType__descriptorAlloc fnDescriptorAlloc;
   roociloadFnType__descriptorFree fnDescriptorFree;
+  roociloadFnType__dirPathAbort fnDirPathAbort;
+  roociloadFnType__dirPathColArrayEntrySet fnDirPathColArrayEntrySet;
+  roociloadFnType__dirPathColArrayReset fnDirPathColArrayReset;
+  roociloadFnType__dirPathColArrayToStream fnDirPathColArrayToStream;
+  roociloadFnType__dirPathFinish fnDirPathFinish;
+  roociloadFnType__dirPathLoadStream fnDirPathLoadStream;
+  roociloadFnType__dirPathPrepare fnDirPathPrepare;
+  roociloadFnType__dirPathStreamReset fnDirPathStreamReset;
   roociloadFnType__envCreate fnEnvCreate;
   roociloadFnType__envNlsCreate fnEnvNlsCreate;
   roociloadFnType__errorGet fnErrorGet;
@@ -600,6 +660,7 @@ struct roociloadSymbols
   roociloadFnType__intervalSetDaySecond fnIntervalSetDaySecond;
   roociloadFnType__iterCreate fnIterCreate;
   roociloadFnType__iterNext fnIterNext;
+  roociloadFnType__lobArrayRead fnLobArrayRead;
   roociloadFnType__lobCreateTemporary fnLobCreateTemporary;
   roociloadFnType__lobFileClose fnLobFileClose;
   roociloadFnType__lobFileOpen fnLobFileOpen;
@@ -632,6 +693,8 @@ struct roociloadSymbols
   roociloadFnType__serverRelease fnServerRelease;
   roociloadFnType__serverVersion fnServerVersion;
   roociloadFnType__sessionGet fnSessionGet;
+  roociloadFnType__sessionPoolCreate fnSessionPoolCreate;
+  roociloadFnType__sessionPoolDestroy fnSessionPoolDestroy;
   roociloadFnType__sessionRelease fnSessionRelease;
   roociloadFnType__stmtExecute fnStmtExecute;
   roociloadFnType__stmtFetch2 fnStmtFetch2;
@@ -644,10 +707,17 @@ struct roociloadSymbols
   roociloadFnType__stringSize fnStringSize;
   roociloadFnType__tableFirst fnTableFirst;
   roociloadFnType__tableNext fnTableNext;
+  roociloadFnType__threadClose fnThreadClose;
   roociloadFnType__threadCreate fnThreadCreate;
+  roociloadFnType__threadHndDestroy fnThreadHndDestroy;
   roociloadFnType__threadHndInit fnThreadHndInit;
+  roociloadFnType__threadIdDestroy fnThreadIdDestroy;
   roociloadFnType__threadIdInit fnThreadIdInit;
   roociloadFnType__threadJoin fnThreadJoin;
+  roociloadFnType__threadMutexAcquire fnThreadMutexAcquire;
+  roociloadFnType__threadMutexDestroy fnThreadMutexDestroy;
+  roociloadFnType__threadMutexInit fnThreadMutexInit;
+  roociloadFnType__threadMutexRelease fnThreadMutexRelease;
   roociloadFnType__transCommit fnTransCommit;
   roociloadFnType__transRollback fnTransRollback;
   roociloadFnType__typeByName fnTypeByName;
@@ -2146,6 +2216,27 @@ sword OCIDateTimeGetTime(void        *hndl,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__dateTimeGetTimeZoneName() [INTERNAL]
+//   Wrapper for OCIDateTimeGetTimeZoneName().
+//-----------------------------------------------------------------------------
+sword OCIDateTimeGetTimeZoneName(void              *hndl,
+                                 OCIError          *err,
+                                 const OCIDateTime *datetime,
+                                 ub1               *buf,
+                                 ub4               *buflen)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dateTimeGetTimeZoneName,
+                        OCIDateTimeGetTimeZoneName,
+                        &loadSyms.fnDateTimeGetTimeZoneName, loadCtx_g);
+  status = (*loadSyms.fnDateTimeGetTimeZoneName)(hndl, err, datetime,
+                                                 buf, buflen);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "get time zone name");
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__dateTimeGetTimeZoneOffset() [INTERNAL]
 //   Wrapper for OCIDateTimeGetTimeZoneOffset().
@@ -2338,6 +2429,152 @@ sword OCIDescriptorFree(void      *descp,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathAbort() [INTERNAL]
+//   Wrapper for OCIDirPathAbort().
+//-----------------------------------------------------------------------------
+sword OCIDirPathAbort(OCIDirPathCtx *dpctx,
+                      OCIError      *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathAbort, OCIDirPathAbort,
+                        &loadSyms.fnDirPathAbort, loadCtx_g);
+  status = (*loadSyms.fnDirPathAbort)(dpctx, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "abort direct path load");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathColArrayEntrySet() [INTERNAL]
+//   Wrapper for OCIDirPathColArrayEntrySet().
+//-----------------------------------------------------------------------------
+sword OCIDirPathColArrayEntrySet(OCIDirPathColArray *dpca,
+                                 OCIError           *errhp,
+                                 ub4                 rownum,
+                                 ub2                 colIdx,
+                                 ub1                *cvalp,
+                                 ub4                 clen,
+                                 ub1                 cflg)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathColArrayEntrySet,
+                        OCIDirPathColArrayEntrySet,
+                        &loadSyms.fnDirPathColArrayEntrySet, loadCtx_g);
+  status = (*loadSyms.fnDirPathColArrayEntrySet)(dpca, errhp, rownum, colIdx,
+                                                 cvalp, clen, cflg);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "set column array entry");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathColArrayReset() [INTERNAL]
+//   Wrapper for OCIDirPathColArrayReset().
+//-----------------------------------------------------------------------------
+sword OCIDirPathColArrayReset(OCIDirPathColArray *dpca,
+                              OCIError           *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathColArrayReset,
+                        OCIDirPathColArrayReset,
+                        &loadSyms.fnDirPathColArrayReset, loadCtx_g);
+  status = (*loadSyms.fnDirPathColArrayReset)(dpca, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "reset column array");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathColArrayToStream() [INTERNAL]
+//   Wrapper for OCIDirPathColArrayToStream().
+//-----------------------------------------------------------------------------
+sword OCIDirPathColArrayToStream(OCIDirPathColArray *dpca,
+                                 OCIDirPathCtx      *dpctx,
+                                 OCIDirPathStream   *dpstr,
+                                 OCIError           *errhp,
+                                 ub4                 rowcnt,
+                                 ub4                 rowoff)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathColArrayToStream,
+                        OCIDirPathColArrayToStream,
+                        &loadSyms.fnDirPathColArrayToStream, loadCtx_g);
+  status = (*loadSyms.fnDirPathColArrayToStream)(dpca, dpctx, dpstr, errhp,
+                                                 rowcnt, rowoff);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "convert column array to stream");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathFinish() [INTERNAL]
+//   Wrapper for OCIDirPathFinish().
+//-----------------------------------------------------------------------------
+sword OCIDirPathFinish(OCIDirPathCtx *dpctx,
+                       OCIError      *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathFinish, OCIDirPathFinish,
+                        &loadSyms.fnDirPathFinish, loadCtx_g);
+  status = (*loadSyms.fnDirPathFinish)(dpctx, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "finish direct path load");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathLoadStream() [INTERNAL]
+//   Wrapper for OCIDirPathLoadStream().
+//-----------------------------------------------------------------------------
+sword OCIDirPathLoadStream(OCIDirPathCtx    *dpctx,
+                           OCIDirPathStream *dpstr,
+                           OCIError         *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathLoadStream,
+                        OCIDirPathLoadStream,
+                        &loadSyms.fnDirPathLoadStream, loadCtx_g);
+  status = (*loadSyms.fnDirPathLoadStream)(dpctx, dpstr, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "load direct path stream");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathPrepare() [INTERNAL]
+//   Wrapper for OCIDirPathPrepare().
+//-----------------------------------------------------------------------------
+sword OCIDirPathPrepare(OCIDirPathCtx *dpctx,
+                        OCISvcCtx     *svchp,
+                        OCIError      *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathPrepare, OCIDirPathPrepare,
+                        &loadSyms.fnDirPathPrepare, loadCtx_g);
+  status = (*loadSyms.fnDirPathPrepare)(dpctx, svchp, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "prepare direct path load");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__dirPathStreamReset() [INTERNAL]
+//   Wrapper for OCIDirPathStreamReset().
+//-----------------------------------------------------------------------------
+sword OCIDirPathStreamReset(OCIDirPathStream *dpstr,
+                            OCIError         *errhp)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__dirPathStreamReset,
+                        OCIDirPathStreamReset,
+                        &loadSyms.fnDirPathStreamReset, loadCtx_g);
+  status = (*loadSyms.fnDirPathStreamReset)(dpstr, errhp);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "reset direct path stream");
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__envCreate() [INTERNAL]
 //   Wrapper for OCIEnvCreate().
@@ -2591,6 +2828,38 @@ sword OCIIterNext(OCIEnv   *env,
   ROOCILOAD_CHECK_AND_RETURN(err, status, "iterator next");
 }
 
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__lobArrayRead() [INTERNAL]
+//   Wrapper for OCILobArrayRead().
+//-----------------------------------------------------------------------------
+sword OCILobArrayRead(OCISvcCtx               *svchp,
+                      OCIError                *errhp,
+                      ub4                     *array_iter,
+                      OCILobLocator          **lobp_arr,
+                      oraub8                  *byte_amt_arr,
+                      oraub8                  *char_amt_arr,
+                      oraub8                  *offset_arr,
+                      void                   **bufp_arr,
+                      oraub8                  *bufl_arr,
+                      ub1                      piece,
+                      void                    *ctxp,
+                      OCICallbackLobArrayRead  cbfp,
+                      ub2                      csid,
+                      ub1                      csfrm)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__lobArrayRead, OCILobArrayRead,
+                        &loadSyms.fnLobArrayRead, loadCtx_g);
+  status = (*loadSyms.fnLobArrayRead)(svchp, errhp, array_iter, lobp_arr,
+                                      byte_amt_arr, char_amt_arr, offset_arr,
+                                      bufp_arr, bufl_arr, piece, ctxp,
+                                      cbfp, csid, csfrm);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "array read from LOB");
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__lobCreateTemporary() [INTERNAL]
 //   Wrapper for OCILobCreateTemporary().
@@ -3265,6 +3534,57 @@ sword OCISessionGet(OCIEnv         *envhp,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__sessionPoolCreate() [INTERNAL]
+//   Wrapper for OCISessionPoolCreate().
+//-----------------------------------------------------------------------------
+sword OCISessionPoolCreate(OCIEnv         *envhp,
+                           OCIError       *errhp,
+                           OCISPool       *spoolhp,
+                           OraText       **poolName,
+                           ub4            *poolNameLen,
+                           const OraText  *connStr,
+                           ub4             connStrLen,
+                           ub4             sessMin,
+                           ub4             sessMax,
+                           ub4             sessIncr,
+                           OraText        *userid,
+                           ub4             useridLen,
+                           OraText        *password,
+                           ub4             passwordLen,
+                           ub4             mode)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__sessionPoolCreate,
+                        OCISessionPoolCreate,
+                        &loadSyms.fnSessionPoolCreate, loadCtx_g);
+  status = (*loadSyms.fnSessionPoolCreate)(envhp, errhp, spoolhp, poolName,
+                        poolNameLen, connStr, connStrLen, sessMin, sessMax,
+                        sessIncr, userid, useridLen, password, passwordLen,
+                        mode);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "create session pool");
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__sessionPoolDestroy() [INTERNAL]
+//   Wrapper for OCISessionPoolDestroy().
+//-----------------------------------------------------------------------------
+sword OCISessionPoolDestroy(OCISPool *spoolhp,
+                            OCIError *errhp,
+                            ub4       mode)
+{
+  sword status;
+
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__sessionPoolDestroy,
+                        OCISessionPoolDestroy,
+                        &loadSyms.fnSessionPoolDestroy, loadCtx_g);
+  status = (*loadSyms.fnSessionPoolDestroy)(spoolhp, errhp, mode);
+  ROOCILOAD_CHECK_AND_RETURN(errhp, status, "destroy session pool");
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__sessionRelease() [INTERNAL]
 //   Wrapper for OCISessionRelease().
@@ -3509,6 +3829,23 @@ sword OCITableNext(OCIEnv         *env,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadClose() [INTERNAL]
+//   Wrapper for OCIThreadClose().
+//-----------------------------------------------------------------------------
+sword OCIThreadClose(void            *hndl,
+                     OCIError        *err,
+                     OCIThreadHandle *tHnd)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadClose, OCIThreadClose,
+                        &loadSyms.fnThreadClose, loadCtx_g);
+  status = (*loadSyms.fnThreadClose)(hndl, err, tHnd);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "close thread");
+  return OCI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__threadCreate() [INTERNAL]
 //   Wrapper for OCIThreadCreate().
@@ -3529,6 +3866,23 @@ sword OCIThreadCreate(void            *hndl,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadHndDestroy() [INTERNAL]
+//   Wrapper for OCIThreadHndDestroy().
+//-----------------------------------------------------------------------------
+sword OCIThreadHndDestroy(void             *hndl,
+                          OCIError         *err,
+                          OCIThreadHandle **tHnd)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadHndDestroy, OCIThreadHndDestroy,
+                        &loadSyms.fnThreadHndDestroy, loadCtx_g);
+  status = (*loadSyms.fnThreadHndDestroy)(hndl, err, tHnd);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "destroy thread handle");
+  return OCI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__threadHndInit() [INTERNAL]
 //   Wrapper for OCIThreadHndInit().
@@ -3546,6 +3900,23 @@ sword OCIThreadHndInit(void             *hndl,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadIdDestroy() [INTERNAL]
+//   Wrapper for OCIThreadIdDestroy().
+//-----------------------------------------------------------------------------
+sword OCIThreadIdDestroy(void          *hndl,
+                         OCIError     *err,
+                         OCIThreadId **tid)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadIdDestroy, OCIThreadIdDestroy,
+                        &loadSyms.fnThreadIdDestroy, loadCtx_g);
+  status = (*loadSyms.fnThreadIdDestroy)(hndl, err, tid);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "thread id destroy");
+  return OCI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__threadIdInit() [INTERNAL]
 //   Wrapper for OCIThreadIdInit().
@@ -3580,6 +3951,78 @@ sword OCIThreadJoin(void            *hndl,
 }
 
 
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadMutexAcquire() [INTERNAL]
+//   Wrapper for OCIThreadMutexAcquire().
+//-----------------------------------------------------------------------------
+sword OCIThreadMutexAcquire(void           *hndl,
+                            OCIError       *err,
+                            OCIThreadMutex *mutex)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadMutexAcquire,
+                        OCIThreadMutexAcquire,
+                        &loadSyms.fnThreadMutexAcquire, loadCtx_g);
+  status = (*loadSyms.fnThreadMutexAcquire)(hndl, err, mutex);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "acquire mutex");
+  return OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadMutexDestroy() [INTERNAL]
+//   Wrapper for OCIThreadMutexDestroy().
+//-----------------------------------------------------------------------------
+sword OCIThreadMutexDestroy(void            *hndl,
+                            OCIError        *err,
+                            OCIThreadMutex **mutex)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadMutexDestroy,
+                        OCIThreadMutexDestroy,
+                        &loadSyms.fnThreadMutexDestroy, loadCtx_g);
+  status = (*loadSyms.fnThreadMutexDestroy)(hndl, err, mutex);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "destroy mutex");
+  return OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadMutexInit() [INTERNAL]
+//   Wrapper for OCIThreadMutexInit().
+//-----------------------------------------------------------------------------
+sword OCIThreadMutexInit(void            *hndl,
+                         OCIError        *err,
+                         OCIThreadMutex **mutex)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadMutexInit,
+                        OCIThreadMutexInit,
+                        &loadSyms.fnThreadMutexInit, loadCtx_g);
+  status = (*loadSyms.fnThreadMutexInit)(hndl, err, mutex);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "init mutex");
+  return OCI_SUCCESS;
+}
+
+
+//-----------------------------------------------------------------------------
+// roociloadFnType__threadMutexRelease() [INTERNAL]
+//   Wrapper for OCIThreadMutexRelease().
+//-----------------------------------------------------------------------------
+sword OCIThreadMutexRelease(void           *hndl,
+                            OCIError       *err,
+                            OCIThreadMutex *mutex)
+{
+  sword status;
+  ROOCILOAD_LOAD_SYMBOL(roociloadFnType__threadMutexRelease,
+                        OCIThreadMutexRelease,
+                        &loadSyms.fnThreadMutexRelease, loadCtx_g);
+  status = (*loadSyms.fnThreadMutexRelease)(hndl, err, mutex);
+  ROOCILOAD_CHECK_AND_RETURN(err, status, "release mutex");
+  return OCI_SUCCESS;
+}
+
+
 //-----------------------------------------------------------------------------
 // roociloadFnType__transCommit() [INTERNAL]
 //   Wrapper for OCITransCommit().